@@ -14,9 +14,16 @@
  */
 
 #include "agent/debugger_impl.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <limits>
+
 #include "backend/debugger_executor.h"
 #include "ecmascript/jspandafile/js_pandafile_manager.h"
 #include "ecmascript/napi/jsnapi_helper.h"
+#include "libpandafile/class_data_accessor-inl.h"
 #include "protocol_handler.h"
 #include "tooling/dynamic/base/pt_base64.h"
 #include "tooling/hybrid_step/hybrid_single_stepper.h"
@@ -39,6 +46,9 @@ const std::string DATA_APP_PATH = "/";
 const std::string DATA_APP_PATH = "/data/";
 #endif
 
+// the objects handed out for the paused call frames, released on resume
+const std::string BACKTRACE_OBJECT_GROUP = "backtrace";
+
 static std::atomic<uint32_t> g_scriptId {0};
 
 DebuggerImpl::DebuggerImpl(const EcmaVM *vm, ProtocolChannel *channel, RuntimeImpl *runtime, bool isHybrid)
@@ -52,6 +62,10 @@ DebuggerImpl::DebuggerImpl(const EcmaVM *vm, ProtocolChannel *channel, RuntimeIm
     updaterFunc_ = std::bind(&DebuggerImpl::UpdateScopeObject, this, _1, _2, _3, _4);
     stepperFunc_ = std::bind(&DebuggerImpl::ClearSingleStepper, this);
     returnNative_ = std::bind(&DebuggerImpl::NotifyReturnNative, this);
+    // the runtime agent is created and destroyed together with the debugger agent by the Dispatcher
+    if (runtime_ != nullptr) {
+        runtime_->lazyObjectLoader_ = std::bind(&DebuggerImpl::MaterializeScope, this, _1);
+    }
     vm_->GetJsDebuggerManager()->SetLocalScopeUpdater(&updaterFunc_);
     vm_->GetJsDebuggerManager()->SetStepperFunc(&stepperFunc_);
     vm_->GetJsDebuggerManager()->SetJSReturnNativeFunc(&returnNative_);
@@ -77,6 +91,13 @@ DebuggerImpl::~DebuggerImpl()
     vm_->GetJsDebuggerManager()->SetLocalScopeUpdater(nullptr);
     vm_->GetJsDebuggerManager()->SetStepperFunc(nullptr);
     vm_->GetJsDebuggerManager()->SetJSReturnNativeFunc(nullptr);
+    // the lazy scopes left in the runtime agent can not be materialized any more
+    if (runtime_ != nullptr) {
+        runtime_->lazyObjectLoader_ = nullptr;
+    }
+    lazyScopes_.clear();
+    // the compiled expressions hold global handles, which outlive the debugger otherwise
+    ClearCompiledExpressions();
     DebuggerApi::DestroyJSDebugger(jsDebugger_);
 }
 
@@ -106,8 +127,8 @@ bool DebuggerImpl::NotifyScriptParsed(const std::string &fileName, std::string_v
     const char *recordName = entryPoint.data();
     auto mainMethodIndex = panda_file::File::EntityId(
         DebuggerApi::GetJSPandaFileMainMethodIndex(jsPandaFile, recordName));
-    const std::string &source = extractor->GetSourceCode(mainMethodIndex);
-    const std::string &url = extractor->GetSourceFile(mainMethodIndex);
+    ScriptDebugInfo debugInfo = GetScriptDebugInfo(jsPandaFile, extractor, mainMethodIndex);
+    const std::string &url = debugInfo.url;
     // if load module, it needs to check whether clear singlestepper_
     ClearSingleStepper();
     if (MatchUrlAndFileName(url, fileName)) {
@@ -116,15 +137,30 @@ bool DebuggerImpl::NotifyScriptParsed(const std::string &fileName, std::string_v
         return false;
     }
 
-    SaveParsedScriptsAndUrl(fileName, url, recordName, source);
+    SaveParsedScriptsAndUrl(fileName, url, recordName, extractor, mainMethodIndex, debugInfo.endLine);
     return true;
 }
 
-std::vector<std::shared_ptr<BreakpointReturnInfo>> DebuggerImpl::SetBreakpointsWhenParsingScript(const std::string &url)
+std::vector<std::shared_ptr<BreakpointReturnInfo>> DebuggerImpl::SetBreakpointsWhenParsingScript(const std::string &url,
+    const std::string &fileName, DebugInfoExtractor *extractor)
 {
     std::vector<std::shared_ptr<BreakpointReturnInfo>> outLocations {};
-    for (const auto &breakpoint : breakpointPendingMap_[url]) {
-        if (!ProcessSingleBreakpoint(*breakpoint, outLocations)) {
+    auto iter = breakpointPendingMap_.find(url);
+    if (iter == breakpointPendingMap_.end()) {
+        return outLocations;
+    }
+    // the scripts parsed before already have these breakpoints, only the new file needs them
+    std::vector<DebugInfoExtractor *> extractors {};
+    if (extractor != nullptr) {
+        extractors.emplace_back(extractor);
+    }
+    // the locations resolved by a former launch of the same file are read from the breakpoints cache
+    std::shared_ptr<JSPandaFile> jsPandaFile {nullptr};
+    if (breakpointsCache_.IsEnabled()) {
+        jsPandaFile = JSPandaFileManager::GetInstance()->FindJSPandaFile(fileName.c_str());
+    }
+    for (const auto &breakpoint : iter->second) {
+        if (!ProcessSingleBreakpoint(*breakpoint, extractors, outLocations, jsPandaFile.get())) {
             std::string invalidBpId = "invalid";
             std::shared_ptr<BreakpointReturnInfo> bpInfo = std::make_shared<BreakpointReturnInfo>();
             bpInfo->SetId(invalidBpId)
@@ -133,13 +169,17 @@ std::vector<std::shared_ptr<BreakpointReturnInfo>> DebuggerImpl::SetBreakpointsW
             outLocations.emplace_back(bpInfo);
         }
     }
+    if (!breakpointsCache_.Flush()) {
+        LOG_DEBUGGER(ERROR) << "SetBreakpointsWhenParsingScript: failed to save the breakpoints cache";
+    }
     return outLocations;
 }
 
-bool DebuggerImpl::NeedToSetBreakpointsWhenParsingScript(const std::string &url)
+bool DebuggerImpl::NeedToSetBreakpointsWhenParsingScript(const std::string &url) const
 {
-    if (breakpointPendingMap_.find(url) != breakpointPendingMap_.end()) {
-        return !breakpointPendingMap_[url].empty();
+    auto iter = breakpointPendingMap_.find(url);
+    if (iter != breakpointPendingMap_.end()) {
+        return !iter->second.empty();
     }
     return false;
 }
@@ -173,24 +213,108 @@ bool DebuggerImpl::IsApplicationFile(const std::string &fileName)
 }
 
 void DebuggerImpl::SaveParsedScriptsAndUrl(const std::string &fileName, const std::string &url,
-    const std::string &recordName, const std::string &source)
+    const std::string &recordName, DebugInfoExtractor *extractor, panda_file::File::EntityId methodId,
+    int32_t endLine)
 {
     // Save recordName to its corresponding url
     recordNames_[url].insert(recordName);
     recordNameSet_.insert(recordName);
     // Save parsed fileName to its corresponding url
     urlFileNameMap_[url].insert(fileName);
-    // Create and save script
-    std::shared_ptr<PtScript> script = std::make_shared<PtScript>(g_scriptId++, fileName, url, source);
-    scripts_[script->GetScriptId()] = script;
+    // Create and save script, its source stays in the debug info of the file
+    std::shared_ptr<PtScript> script;
+    if (extractor != nullptr) {
+        script = std::make_shared<PtScript>(g_scriptId++, fileName, url, endLine, GetSourceLoader(methodId));
+    } else {
+        script = std::make_shared<PtScript>(g_scriptId++, fileName, url, "");
+    }
+    AddScript(script);
     // Check if is launch accelerate mode & has pending bps to set
     if (IsLaunchAccelerateMode() && NeedToSetBreakpointsWhenParsingScript(url)) {
-        script->SetLocations(SetBreakpointsWhenParsingScript(url));
+        script->SetLocations(SetBreakpointsWhenParsingScript(url, fileName, extractor));
     }
     // Notify frontend ScriptParsed event
     frontend_.ScriptParsed(vm_, *script);
 }
 
+PtScript::SourceLoader DebuggerImpl::GetSourceLoader(panda_file::File::EntityId methodId)
+{
+    return [methodId](const std::string &fileName) -> std::string {
+        std::shared_ptr<JSPandaFile> jsPandaFile = JSPandaFileManager::GetInstance()->FindJSPandaFile(fileName.c_str());
+        if (jsPandaFile == nullptr) {
+            LOG_DEBUGGER(ERROR) << "GetSourceLoader: unknown file: " << fileName;
+            return "";
+        }
+        DebugInfoExtractor *extractor = JSPandaFileManager::GetInstance()->GetJSPtExtractor(jsPandaFile.get());
+        if (extractor == nullptr) {
+            LOG_DEBUGGER(ERROR) << "GetSourceLoader: Unsupported file: " << fileName;
+            return "";
+        }
+        return extractor->GetSourceCode(methodId);
+    };
+}
+
+ScriptDebugInfo DebuggerImpl::GetScriptDebugInfo(const JSPandaFile *jsPandaFile,
+    DebugInfoExtractor *extractor, panda_file::File::EntityId methodId)
+{
+    DebugInfoFileKey key {std::string(DebuggerApi::GetJSPandaFileDesc(jsPandaFile)),
+        jsPandaFile->GetPandaFile()->GetHeader()->checksum};
+    // the url is kept by the extractor shared by all the VMs, the end line comes from the line tables,
+    // so that the source stays in the file until it is requested
+    const std::string &url = extractor->GetSourceFile(methodId);
+    int32_t endLine = GetFileDebugInfo(key)->GetEndLine(url, [jsPandaFile, extractor]() {
+        return ScanEndLines(jsPandaFile, extractor);
+    });
+    return ScriptDebugInfo {url, endLine};
+}
+
+FileDebugInfo *DebuggerImpl::GetFileDebugInfo(const DebugInfoFileKey &key)
+{
+    auto iter = fileDebugInfos_.find(key);
+    if (iter == fileDebugInfos_.end()) {
+        iter = fileDebugInfos_.emplace(key, PtDebugInfoCache::GetInstance()->Acquire(key)).first;
+    }
+    return iter->second.get();
+}
+
+FileDebugInfo::EndLines DebuggerImpl::ScanEndLines(const JSPandaFile *jsPandaFile, DebugInfoExtractor *extractor)
+{
+    FileDebugInfo::EndLines endLines {};
+    const panda_file::File &pandaFile = *jsPandaFile->GetPandaFile();
+    for (uint32_t classId : jsPandaFile->GetClasses()) {
+        panda_file::File::EntityId id(classId);
+        if (jsPandaFile->IsExternal(id)) {
+            continue;
+        }
+        panda_file::ClassDataAccessor cda(pandaFile, id);
+        cda.EnumerateMethods([extractor, &endLines](panda_file::MethodDataAccessor &mda) {
+            panda_file::File::EntityId methodId = mda.GetMethodId();
+            int32_t &endLine = endLines[extractor->GetSourceFile(methodId)];
+            for (const auto &entry : extractor->GetLineNumberTable(methodId)) {
+                if (entry.line != DebugInfoExtractor::SPECIAL_LINE_MARK) {
+                    endLine = std::max(endLine, entry.line);
+                }
+            }
+        });
+    }
+    return endLines;
+}
+
+void DebuggerImpl::AddScript(const std::shared_ptr<PtScript> &script)
+{
+    // a reloaded url may have changed the code the cached expressions were compiled against
+    if (urlScripts_.find(script->GetUrl()) != urlScripts_.end()) {
+        ClearCompiledExpressions();
+        methodBlackboxes_.clear();
+    }
+    script->SetBlackboxed(MatchBlackboxPatterns(blackboxPatterns_, script->GetUrl()));
+    scripts_[script->GetScriptId()] = script;
+    urlScripts_[script->GetUrl()].push_back(script.get());
+    fileNameScripts_[script->GetFileName()].push_back(script.get());
+    // the first parsed script wins if the sources are the same
+    hashScripts_.emplace(script->GetHash(), script.get());
+}
+
 bool DebuggerImpl::NotifyScriptParsedBySendable(JSHandle<Method> method)
 {
     JSThread *thread = vm_->GetJSThread();
@@ -206,12 +330,13 @@ bool DebuggerImpl::NotifyScriptParsedBySendable(JSHandle<Method> method)
         return false;
     }
     auto methodId = method->GetMethodId();
-    const std::string &url = extractor->GetSourceFile(methodId);
     const std::string &fileName = std::string(DebuggerApi::GetJSPandaFileDesc(jsPandaFile));
     // Check url path & is debugable in module.json
     if (!CheckScriptParsed(fileName)) {
         return false;
     }
+    ScriptDebugInfo debugInfo = GetScriptDebugInfo(jsPandaFile, extractor, methodId);
+    const std::string &url = debugInfo.url;
     // Clear SingleStepper before notify
     ClearSingleStepper();
     // Check if this (url, fileName) pair has already been parsed
@@ -221,9 +346,8 @@ bool DebuggerImpl::NotifyScriptParsedBySendable(JSHandle<Method> method)
         return false;
     }
     // Parse and save this file
-    const std::string &source = extractor->GetSourceCode(methodId);
     const std::string &recordName = std::string(method->GetRecordNameStr(thread));
-    SaveParsedScriptsAndUrl(fileName, url, recordName, source);
+    SaveParsedScriptsAndUrl(fileName, url, recordName, extractor, methodId, debugInfo.endLine);
     return true;
 }
 
@@ -250,6 +374,10 @@ bool DebuggerImpl::NotifyNativeOut()
 bool DebuggerImpl::NotifySingleStep(const JSPtLocation &location)
 {
     if (UNLIKELY(pauseOnNextByteCode_)) {
+        if (StepOutOfBlackboxedMethod(location)) {
+            pauseOnNextByteCode_ = false;
+            return false;
+        }
         if (IsSkipLine(location)) {
             return false;
         }
@@ -263,7 +391,12 @@ bool DebuggerImpl::NotifySingleStep(const JSPtLocation &location)
     }
 
     // step not complete
-    if (!singleStepper_->StepComplete(location.GetBytecodeOffset())) {
+    if (!singleStepper_->StepComplete(location)) {
+        return false;
+    }
+
+    // a step landing in a blackboxed method runs on until it returns, instead of checking each of its bytecodes
+    if (StepOutOfBlackboxedMethod(location)) {
         return false;
     }
 
@@ -282,6 +415,11 @@ bool DebuggerImpl::NotifySingleStep(const JSPtLocation &location)
 
 bool DebuggerImpl::IsSkipLine(const JSPtLocation &location)
 {
+    // blackboxed code is stepped through without pausing
+    if (IsBlackboxed(location)) {
+        return true;
+    }
+
     DebugInfoExtractor *extractor = nullptr;
     const auto *jsPandaFile = location.GetJsPandaFile();
     auto scriptFunc = [this, &extractor, jsPandaFile](PtScript *) -> bool {
@@ -309,6 +447,120 @@ bool DebuggerImpl::IsSkipLine(const JSPtLocation &location)
     return false;
 }
 
+bool DebuggerImpl::StepOutOfBlackboxedMethod(const JSPtLocation &location)
+{
+    if ((blackboxPatterns_.empty() && !hasBlackboxedRanges_) || !GetMethodBlackbox(location).blackboxed) {
+        return false;
+    }
+    // a pause requested on the next bytecode becomes a step out, it pauses in the first caller not blackboxed
+    if (singleStepper_ == nullptr) {
+        singleStepper_ = SingleStepper::GetStepOutStepper(vm_);
+        if (singleStepper_ == nullptr) {
+            return false;
+        }
+    }
+    // the step goes on when the method returns, a blackboxed caller is skipped the same way
+    singleStepper_->SkipCurrentFrame();
+    return true;
+}
+
+bool DebuggerImpl::IsMethodInBlackboxedRange(const JSPtLocation &location,
+    const std::vector<std::pair<int32_t, int32_t>> &ranges)
+{
+    DebugInfoExtractor *extractor = GetExtractor(location.GetJsPandaFile());
+    if (extractor == nullptr) {
+        return false;
+    }
+    int32_t minLine = std::numeric_limits<int32_t>::max();
+    int32_t maxLine = -1;
+    for (const auto &entry : extractor->GetLineNumberTable(location.GetMethodId())) {
+        if (entry.line == DebugInfoExtractor::SPECIAL_LINE_MARK) {
+            continue;
+        }
+        minLine = std::min(minLine, entry.line);
+        maxLine = std::max(maxLine, entry.line);
+    }
+    if (maxLine < minLine) {
+        return false;
+    }
+    // all the lines of the method are inside the same range, no range starts or ends between them
+    auto first = std::upper_bound(ranges.begin(), ranges.end(), std::make_pair(minLine, 0));
+    auto last = std::upper_bound(ranges.begin(), ranges.end(),
+        std::make_pair(maxLine, std::numeric_limits<int32_t>::max()));
+    return first == last && (first - ranges.begin()) % 2 == 1;  // 2: a start and an end position per range
+}
+
+const DebuggerImpl::MethodBlackbox &DebuggerImpl::GetMethodBlackbox(const JSPtLocation &location)
+{
+    // the blackbox state of a method is only looked up once, it is dropped when the patterns or ranges change
+    auto key = std::make_pair(location.GetJsPandaFile(), location.GetMethodId().GetOffset());
+    auto iter = methodBlackboxes_.find(key);
+    if (iter == methodBlackboxes_.end()) {
+        MethodBlackbox method {};
+        PtScript *script = FindMethodScript(location);
+        if (script != nullptr) {
+            const auto &ranges = script->GetBlackboxedRanges();
+            method.blackboxed = script->IsBlackboxed() ||
+                (!ranges.empty() && IsMethodInBlackboxedRange(location, ranges));
+            method.rangesScript = ranges.empty() ? nullptr : script;
+        }
+        iter = methodBlackboxes_.emplace(key, method).first;
+    }
+    return iter->second;
+}
+
+bool DebuggerImpl::IsBlackboxed(const JSPtLocation &location)
+{
+    if (blackboxPatterns_.empty() && !hasBlackboxedRanges_) {
+        return false;
+    }
+    const MethodBlackbox &method = GetMethodBlackbox(location);
+    if (method.blackboxed) {
+        return true;
+    }
+    if (method.rangesScript == nullptr) {
+        return false;
+    }
+    const auto &ranges = method.rangesScript->GetBlackboxedRanges();
+
+    DebugInfoExtractor *extractor = GetExtractor(location.GetJsPandaFile());
+    if (extractor == nullptr) {
+        return false;
+    }
+    std::pair<int32_t, int32_t> position {-1, -1};
+    auto callbackLineFunc = [&position](int32_t line) -> bool {
+        position.first = line;
+        return true;
+    };
+    auto callbackColumnFunc = [&position](int32_t column) -> bool {
+        position.second = column;
+        return true;
+    };
+    panda_file::File::EntityId methodId = location.GetMethodId();
+    uint32_t offset = location.GetBytecodeOffset();
+    if (!extractor->MatchLineWithOffset(callbackLineFunc, methodId, offset) ||
+        !extractor->MatchColumnWithOffset(callbackColumnFunc, methodId, offset)) {
+        return false;
+    }
+    // inside a range when an odd number of positions are at or before it
+    auto count = std::upper_bound(ranges.begin(), ranges.end(), position) - ranges.begin();
+    return count % 2 == 1;  // 2: a start and an end position per range
+}
+
+PtScript *DebuggerImpl::FindMethodScript(const JSPtLocation &location)
+{
+    DebugInfoExtractor *extractor = GetExtractor(location.GetJsPandaFile());
+    if (extractor == nullptr) {
+        return nullptr;
+    }
+    auto iter = urlScripts_.find(extractor->GetSourceFile(location.GetMethodId()));
+    if (iter == urlScripts_.end() || iter->second.empty()) {
+        return nullptr;
+    }
+    // the latest script of a reloaded url
+    return iter->second.back();
+}
+
 bool DebuggerImpl::CheckPauseOnException()
 {
     if (pauseOnException_ == PauseOnExceptionsState::NONE) {
@@ -322,6 +574,173 @@ bool DebuggerImpl::CheckPauseOnException()
     return true;
 }
 
+void DebuggerImpl::NotifyException(const JSPtLocation &location)
+{
+    if (skipAllPausess_ || !CheckPauseOnException()) {
+        return;
+    }
+    if (!exceptionErrorNames_.empty() || !exceptionUrlPatterns_.empty() || exceptionThrowsPerPause_ > 1) {
+        Local<JSValueRef> exception = DebuggerApi::GetAndClearException(vm_);
+        bool pause = CheckExceptionFilters(location, exception);
+        DebuggerApi::SetException(vm_, exception);
+        if (!pause) {
+            return;
+        }
+    }
+    NotifyPaused({}, EXCEPTION);
+}
+
+bool DebuggerImpl::CheckExceptionFilters(const JSPtLocation &location, Local<JSValueRef> exception)
+{
+    if (!MatchExceptionErrorName(exception)) {
+        return false;
+    }
+    if (!exceptionUrlPatterns_.empty()) {
+        PtScript *script = FindMethodScript(location);
+        if (script == nullptr || !MatchExceptionUrl(script->GetUrl())) {
+            return false;
+        }
+    }
+    // the throw is only counted by the sampler once the other filters let it through
+    return SampleExceptionSite(location);
+}
+
+bool DebuggerImpl::MatchExceptionErrorName(Local<JSValueRef> exception) const
+{
+    if (exceptionErrorNames_.empty()) {
+        return true;
+    }
+    if (!exception->IsObject(vm_)) {
+        return false;
+    }
+    Local<JSValueRef> constructor = Local<ObjectRef>(exception)->Get(vm_, StringRef::NewFromUtf8(vm_, "constructor"));
+    if (!constructor->IsFunction(vm_)) {
+        return false;
+    }
+    std::string name = Local<FunctionRef>(constructor)->GetName(vm_)->ToString(vm_);
+    return exceptionErrorNames_.count(name) != 0;
+}
+
+bool DebuggerImpl::MatchExceptionUrl(const std::string &url) const
+{
+    return exceptionUrlPatterns_.empty() || MatchBlackboxPatterns(exceptionUrlPatterns_, url);
+}
+
+bool DebuggerImpl::SampleExceptionSite(const JSPtLocation &location)
+{
+    if (exceptionThrowsPerPause_ <= 1) {
+        return true;
+    }
+    // pauses on the first throw of the site, and then once every throwsPerPause throws
+    uint32_t &throws = exceptionSiteThrows_[GetBreakpointActionKey(location)];
+    return throws++ % exceptionThrowsPerPause_ == 0;
+}
+
+bool DebuggerImpl::NotifyBreakpointHit(const JSPtLocation &location)
+{
+    if (LIKELY(breakpointActions_.empty()) || skipAllPausess_ || !breakpointsState_) {
+        return true;
+    }
+    auto iter = breakpointActions_.find(GetBreakpointActionKey(location));
+    if (iter == breakpointActions_.end()) {
+        return true;
+    }
+    BreakpointAction &action = iter->second;
+    action.hitCount++;
+    if (action.hitConditionType == HitConditionType::EVERY && action.hitCount % action.hitConditionCount != 0) {
+        return false;
+    }
+    if (action.hitConditionType == HitConditionType::AFTER && action.hitCount <= action.hitConditionCount) {
+        return false;
+    }
+    if (!action.logMessage.has_value()) {
+        return true;
+    }
+
+    // a logpoint reports its message and lets the VM run on
+    std::string message = FormatLogMessage(action.logMessage.value());
+    std::vector<std::unique_ptr<RemoteObject>> args;
+    args.emplace_back(RemoteObject::FromTagged(vm_, StringRef::NewFromUtf8(vm_, message.c_str())));
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    tooling::ConsoleAPICalled consoleAPICalled;
+    consoleAPICalled.SetType("log")
+        .SetArgs(std::move(args))
+        .SetTimestamp(std::chrono::duration<double, std::milli>(now).count());
+    frontend_.ConsoleAPICalled(vm_, consoleAPICalled);
+    return false;
+}
+
+std::string DebuggerImpl::FormatLogMessage(const std::string &logMessage)
+{
+    std::shared_ptr<FrameHandler> topFrameHandler = nullptr;
+    auto walkerFunc = [this, &topFrameHandler](const FrameHandler *frameHandler) -> StackState {
+        if (DebuggerApi::IsNativeMethod(frameHandler)) {
+            return StackState::CONTINUE;
+        }
+        topFrameHandler = DebuggerApi::NewFrameHandler(vm_);
+        *topFrameHandler = *frameHandler;
+        return StackState::SUCCESS;
+    };
+    DebuggerApi::StackWalker(vm_, walkerFunc);
+
+    // every {name} in the message is replaced by the value of the variable visible in the top frame
+    std::string message;
+    std::string::size_type pos = 0;
+    while (pos < logMessage.size()) {
+        std::string::size_type start = logMessage.find('{', pos);
+        std::string::size_type end = start == std::string::npos ? start : logMessage.find('}', start);
+        if (end == std::string::npos) {
+            message.append(logMessage, pos, std::string::npos);
+            break;
+        }
+        message.append(logMessage, pos, start - pos);
+        std::string name = Trim(logMessage.substr(start + 1, end - start - 1));
+        Local<JSValueRef> value;
+        if (topFrameHandler != nullptr && !name.empty()) {
+            value = DebuggerExecutor::GetValue(vm_, topFrameHandler.get(), StringRef::NewFromUtf8(vm_, name.c_str()));
+        }
+        if (value.IsEmpty()) {
+            // an unknown variable is left in the message as it is
+            DebuggerApi::ClearException(vm_);
+            message.append(logMessage, start, end - start + 1);
+        } else if (value->IsString(vm_)) {
+            message += Local<StringRef>(value)->DebuggerToString(vm_);
+        } else {
+            std::unique_ptr<RemoteObject> remoteObject = RemoteObject::FromTagged(vm_, value);
+            if (remoteObject->HasDescription()) {
+                message += remoteObject->GetDescription();
+            } else if (remoteObject->HasPreviewValue()) {
+                message += remoteObject->GetPreviewValue();
+            }
+        }
+        pos = end + 1;
+    }
+    return message;
+}
+
+bool DebuggerImpl::ParseHitCondition(const std::string &hitCondition, BreakpointAction *action)
+{
+    // "%N": every Nth hit, ">N": every hit after the Nth
+    std::string condition = Trim(hitCondition);
+    if (condition.empty()) {
+        action->hitConditionType = HitConditionType::NONE;
+        return true;
+    }
+    int32_t count = 0;
+    if (!ToolchainUtils::StrToInt32(Trim(condition.substr(1)), count)) {
+        return false;
+    }
+    if (condition[0] == '%' && count > 0) {
+        action->hitConditionType = HitConditionType::EVERY;
+    } else if (condition[0] == '>' && count >= 0) {
+        action->hitConditionType = HitConditionType::AFTER;
+    } else {
+        return false;
+    }
+    action->hitConditionCount = static_cast<uint32_t>(count);
+    return true;
+}
+
 void DebuggerImpl::NotifyPaused(std::optional<JSPtLocation> location, PauseReason reason)
 {
     if (skipAllPausess_) {
@@ -382,19 +801,23 @@ void DebuggerImpl::GeneratePausedInfo(PauseReason reason,
     if (isHybrid_) {
         DebuggerApi::UnionStackIsEmpty(vm_, &isEmptyUnionStack);
     }
-    if (isEmptyUnionStack) {
-        if (!GenerateCallFrames(&callFrames, true)) {
-            LOG_DEBUGGER(ERROR) << "NotifyPaused: GenerateCallFrames failed";
-            return;
-        }
-    } else {
-        if (!GenerateHybridFrames(&callFrames)) {
-            LOG_DEBUGGER(ERROR) << "NotifyPaused: GenerateHybridFrames failed";
-            return;
-        }
+    // the frames stay alive while paused, so the scopes are only filled when the frontend inspects them
+    lazyScopeChain_ = true;
+    RemoteObjectId firstObjectId = runtime_->curObjectId_;
+    bool generated = isEmptyUnionStack ? GenerateCallFrames(&callFrames, true, pausedCallFramesLimit_) :
+        GenerateHybridFrames(&callFrames);
+    runtime_->AddObjectGroup(BACKTRACE_OBJECT_GROUP, firstObjectId);
+    lazyScopeChain_ = false;
+    if (!generated) {
+        LOG_DEBUGGER(ERROR) << "NotifyPaused: " << (isEmptyUnionStack ? "GenerateCallFrames" : "GenerateHybridFrames")
+                            << " failed";
+        return;
     }
 
     tooling::Paused paused;
+    if (isEmptyUnionStack && pausedCallFramesLimit_ != 0) {
+        paused.SetHasMore(callFrameHandlers_.size() > callFrames.size());
+    }
     if (reason == DEBUGGERSTMT) {
         BreakpointDetails detail;
         hitBreakpoints.emplace_back(BreakpointDetails::ToString(detail));
@@ -409,8 +832,13 @@ void DebuggerImpl::GeneratePausedInfo(PauseReason reason,
         paused.SetData(std::move(tmpException));
     }
     if (vm_->GetJsDebuggerManager()->IsAsyncStackTrace()) {
-        paused.SetAsyncCallChainDepth(maxAsyncCallChainDepth_);
-        paused.SetAysncStack(DebuggerApi::GetCurrentAsyncParent(vm_));
+        std::shared_ptr<AsyncStack> asyncStack = DebuggerApi::GetCurrentAsyncParent(vm_);
+        if (asyncStackTraceId_ && asyncStack != nullptr && maxAsyncCallChainDepth_ > 0) {
+            paused.SetAsyncStackTrace(GenerateStackTrace(asyncStack, 1));
+        } else {
+            paused.SetAsyncCallChainDepth(maxAsyncCallChainDepth_);
+            paused.SetAysncStack(asyncStack);
+        }
     }
     frontend_.Paused(vm_, paused);
     if (reason != BREAK_ON_START && reason != NATIVE_OUT) {
@@ -425,12 +853,36 @@ void DebuggerImpl::GeneratePausedInfo(PauseReason reason,
 bool DebuggerImpl::IsUserCode(const void *nativeAddress)
 {
     uint64_t nativeEntry =  reinterpret_cast<uint64_t>(nativeAddress);
-    for (const auto &nativeRange : nativeRanges_) {
-        if (nativeEntry >= nativeRange.GetStart() && nativeEntry <= nativeRange.GetEnd()) {
-            return true;
+    // the last range starting at or before the address is the only one that may hold it
+    auto iter = std::upper_bound(nativeRanges_.begin(), nativeRanges_.end(), nativeEntry,
+        [](uint64_t address, const NativeRange &nativeRange) { return address < nativeRange.GetStart(); });
+    if (iter == nativeRanges_.begin()) {
+        return false;
+    }
+    return nativeEntry <= std::prev(iter)->GetEnd();
+}
+
+std::vector<NativeRange> DebuggerImpl::MergeNativeRanges(std::vector<NativeRange> nativeRanges)
+{
+    std::sort(nativeRanges.begin(), nativeRanges.end(), [](const NativeRange &lhs, const NativeRange &rhs) {
+        return lhs.GetStart() < rhs.GetStart();
+    });
+    std::vector<NativeRange> merged;
+    for (const auto &nativeRange : nativeRanges) {
+        if (nativeRange.GetStart() > nativeRange.GetEnd()) {
+            LOG_DEBUGGER(WARN) << "DebuggerImpl::MergeNativeRanges: drop the empty range "
+                               << nativeRange.GetStart() << "-" << nativeRange.GetEnd();
+            continue;
         }
+        // the ends are inclusive, a range starting right after the previous one extends it
+        if (!merged.empty() && (nativeRange.GetStart() <= merged.back().GetEnd() ||
+            nativeRange.GetStart() - merged.back().GetEnd() == 1)) {
+            merged.back().SetEnd(std::max(merged.back().GetEnd(), nativeRange.GetEnd()));
+            continue;
+        }
+        merged.emplace_back(nativeRange);
     }
-    return false;
+    return merged;
 }
 
 void DebuggerImpl::NotifyNativeCalling(const void *nativeAddress)
@@ -515,7 +967,9 @@ void DebuggerImpl::InitializeExtendedProtocolsList()
         "smartStepInto",
         "saveAllPossibleBreakpoints",
         "setSymbolicBreakpoints",
-        "removeSymbolicBreakpoints"
+        "removeSymbolicBreakpoints",
+        "setPausedCallFramesLimit",
+        "getCallFrames"
     };
     debuggerExtendedProtocols_ = std::move(debuggerProtocolList);
 }
@@ -569,6 +1023,9 @@ std::optional<std::string> DebuggerImpl::DispatcherImpl::Dispatch(
         case Method::GET_SCRIPT_SOURCE:
             response = GetScriptSource(request, result);
             break;
+        case Method::GET_STACK_TRACE:
+            response = GetStackTrace(request, result);
+            break;
         case Method::PAUSE:
             response = Pause(request);
             break;
@@ -614,6 +1071,9 @@ std::optional<std::string> DebuggerImpl::DispatcherImpl::Dispatch(
         case Method::SET_BLACKBOX_PATTERNS:
             response = SetBlackboxPatterns(request);
             break;
+        case Method::SET_BLACKBOXED_RANGES:
+            response = SetBlackboxedRanges(request);
+            break;
         case Method::REPLY_NATIVE_CALLING:
             response = ReplyNativeCalling(request);
             break;
@@ -641,6 +1101,12 @@ std::optional<std::string> DebuggerImpl::DispatcherImpl::Dispatch(
         case Method::REMOVE_SYMBOLIC_BREAKPOINTS:
             response = RemoveSymbolicBreakpoints(request);
             break;
+        case Method::SET_PAUSED_CALL_FRAMES_LIMIT:
+            response = SetPausedCallFramesLimit(request);
+            break;
+        case Method::GET_CALL_FRAMES:
+            response = GetCallFrames(request, result);
+            break;
         default:
             response = DispatchResponse::Fail("Unknown method: " + request.GetMethod());
             break;
@@ -670,6 +1136,8 @@ DebuggerImpl::DispatcherImpl::Method DebuggerImpl::DispatcherImpl::GetMethodEnum
         return Method::GET_POSSIBLE_BREAKPOINTS;
     } else if (method == "getScriptSource") {
         return Method::GET_SCRIPT_SOURCE;
+    } else if (method == "getStackTrace") {
+        return Method::GET_STACK_TRACE;
     } else if (method == "pause") {
         return Method::PAUSE;
     } else if (method == "removeBreakpoint") {
@@ -700,6 +1168,8 @@ DebuggerImpl::DispatcherImpl::Method DebuggerImpl::DispatcherImpl::GetMethodEnum
         return Method::SET_MIXED_DEBUG_ENABLED;
     } else if (method == "setBlackboxPatterns") {
         return Method::SET_BLACKBOX_PATTERNS;
+    } else if (method == "setBlackboxedRanges") {
+        return Method::SET_BLACKBOXED_RANGES;
     } else if (method == "replyNativeCalling") {
         return Method::REPLY_NATIVE_CALLING;
     } else if (method == "getPossibleAndSetBreakpointByUrl") {
@@ -720,6 +1190,10 @@ DebuggerImpl::DispatcherImpl::Method DebuggerImpl::DispatcherImpl::GetMethodEnum
         return Method::SET_SYMBOLIC_BREAKPOINTS;
     } else if (method == "removeSymbolicBreakpoints") {
         return Method::REMOVE_SYMBOLIC_BREAKPOINTS;
+    } else if (method == "setPausedCallFramesLimit") {
+        return Method::SET_PAUSED_CALL_FRAMES_LIMIT;
+    } else if (method == "getCallFrames") {
+        return Method::GET_CALL_FRAMES;
     } else {
         return Method::UNKNOWN;
     }
@@ -800,6 +1274,21 @@ DispatchResponse DebuggerImpl::DispatcherImpl::GetScriptSource(const DispatchReq
     return response;
 }
 
+DispatchResponse DebuggerImpl::DispatcherImpl::GetStackTrace(const DispatchRequest &request,
+    std::unique_ptr<PtBaseReturns> &result)
+{
+    std::unique_ptr<GetStackTraceParams> params = GetStackTraceParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    std::unique_ptr<StackTrace> stackTrace;
+    DispatchResponse response = debugger_->GetStackTrace(*params, &stackTrace);
+    if (stackTrace != nullptr) {
+        result = std::make_unique<GetStackTraceReturns>(std::move(stackTrace));
+    }
+    return response;
+}
+
 DispatchResponse DebuggerImpl::DispatcherImpl::Pause(const DispatchRequest &request)
 {
     DispatchResponse response = debugger_->Pause();
@@ -910,6 +1399,33 @@ DispatchResponse DebuggerImpl::DispatcherImpl::RemoveSymbolicBreakpoints(const D
     return response;
 }
 
+DispatchResponse DebuggerImpl::DispatcherImpl::SetPausedCallFramesLimit(const DispatchRequest &request)
+{
+    std::unique_ptr<SetPausedCallFramesLimitParams> params =
+        SetPausedCallFramesLimitParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    DispatchResponse response = debugger_->SetPausedCallFramesLimit(*params);
+    return response;
+}
+
+DispatchResponse DebuggerImpl::DispatcherImpl::GetCallFrames(const DispatchRequest &request,
+    std::unique_ptr<PtBaseReturns> &result)
+{
+    std::unique_ptr<GetCallFramesParams> params = GetCallFramesParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    std::vector<std::unique_ptr<CallFrame>> callFrames;
+    bool hasMore = false;
+    DispatchResponse response = debugger_->GetCallFrames(*params, &callFrames, &hasMore);
+    if (response.IsOk()) {
+        result = std::make_unique<GetCallFramesReturns>(std::move(callFrames), hasMore);
+    }
+    return response;
+}
+
 DispatchResponse DebuggerImpl::DispatcherImpl::SetAsyncCallStackDepth(const DispatchRequest &request)
 {
     std::unique_ptr<SetAsyncCallStackDepthParams> params =
@@ -1021,7 +1537,21 @@ DispatchResponse DebuggerImpl::DispatcherImpl::ReplyNativeCalling(const Dispatch
 
 DispatchResponse DebuggerImpl::DispatcherImpl::SetBlackboxPatterns(const DispatchRequest &request)
 {
-    DispatchResponse response = debugger_->SetBlackboxPatterns();
+    std::unique_ptr<SetBlackboxPatternsParams> params = SetBlackboxPatternsParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    DispatchResponse response = debugger_->SetBlackboxPatterns(*params);
+    return response;
+}
+
+DispatchResponse DebuggerImpl::DispatcherImpl::SetBlackboxedRanges(const DispatchRequest &request)
+{
+    std::unique_ptr<SetBlackboxedRangesParams> params = SetBlackboxedRangesParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    DispatchResponse response = debugger_->SetBlackboxedRanges(*params);
     return response;
 }
 
@@ -1108,6 +1638,15 @@ void DebuggerImpl::Frontend::MixedStack(const EcmaVM *vm, const tooling::MixedSt
     channel_->SendNotification(mixedStack);
 }
 
+void DebuggerImpl::Frontend::ConsoleAPICalled(const EcmaVM *vm, const tooling::ConsoleAPICalled &consoleAPICalled)
+{
+    if (!AllowNotify(vm)) {
+        return;
+    }
+
+    channel_->SendNotification(consoleAPICalled);
+}
+
 void DebuggerImpl::Frontend::Resumed(const EcmaVM *vm)
 {
     if (!AllowNotify(vm)) {
@@ -1135,8 +1674,37 @@ void DebuggerImpl::Frontend::ScriptParsed(const EcmaVM *vm, const PtScript &scri
         return;
     }
 
-    tooling::ScriptParsed scriptParsed;
-    scriptParsed.SetScriptId(script.GetScriptId())
+    channel_->SendNotification(*CreateScriptParsed(script));
+}
+
+void DebuggerImpl::Frontend::ScriptsParsed(const EcmaVM *vm,
+    const std::unordered_map<ScriptId, std::shared_ptr<PtScript>> &scripts)
+{
+    if (!AllowNotify(vm)) {
+        return;
+    }
+
+    std::vector<std::unique_ptr<tooling::ScriptParsed>> chunk;
+    for (const auto &item : scripts) {
+        chunk.emplace_back(CreateScriptParsed(*item.second));
+        if (chunk.size() == MAX_SCRIPTS_PARSED_CHUNK) {
+            tooling::ScriptsParsed scriptsParsed;
+            scriptsParsed.SetScripts(std::move(chunk));
+            channel_->SendNotification(scriptsParsed);
+            chunk.clear();
+        }
+    }
+    if (!chunk.empty()) {
+        tooling::ScriptsParsed scriptsParsed;
+        scriptsParsed.SetScripts(std::move(chunk));
+        channel_->SendNotification(scriptsParsed);
+    }
+}
+
+std::unique_ptr<tooling::ScriptParsed> DebuggerImpl::Frontend::CreateScriptParsed(const PtScript &script)
+{
+    auto scriptParsed = std::make_unique<tooling::ScriptParsed>();
+    scriptParsed->SetScriptId(script.GetScriptId())
         .SetUrl(script.GetUrl())
         .SetStartLine(0)
         .SetStartColumn(0)
@@ -1145,8 +1713,7 @@ void DebuggerImpl::Frontend::ScriptParsed(const EcmaVM *vm, const PtScript &scri
         .SetExecutionContextId(0)
         .SetHash(script.GetHash())
         .SetLocations(script.GetLocations());
-
-    channel_->SendNotification(scriptParsed);
+    return scriptParsed;
 }
 
 void DebuggerImpl::Frontend::WaitForDebugger(const EcmaVM *vm)
@@ -1183,8 +1750,21 @@ DispatchResponse DebuggerImpl::Enable([[maybe_unused]] const EnableParams &param
     vm_->GetJsDebuggerManager()->SetDebugMode(true);
     // Enable corresponding features requested by IDE
     EnableDebuggerFeatures(params);
-    for (auto &script : scripts_) {
-        frontend_.ScriptParsed(vm_, *script.second);
+    if (params.HasMaxScriptsCacheSize()) {
+        double maxScriptsCacheSize = std::clamp(params.GetMaxScriptsCacheSize(), 0.0,
+            static_cast<double>(std::numeric_limits<uint32_t>::max()));
+        scriptSourceCache_.SetCapacity(static_cast<size_t>(maxScriptsCacheSize));
+    }
+    if (params.HasBreakpointsCachePath() && !breakpointsCache_.Load(params.GetBreakpointsCachePath())) {
+        LOG_DEBUGGER(ERROR) << "Enable: breakpoints cache disabled, " << params.GetBreakpointsCachePath()
+                            << " is not a breakpoints cache file or could not be compacted";
+    }
+    if (batchScriptParsed_) {
+        frontend_.ScriptsParsed(vm_, scripts_);
+    } else {
+        for (auto &script : scripts_) {
+            frontend_.ScriptParsed(vm_, *script.second);
+        }
     }
     debuggerState_ = DebuggerState::ENABLED;
     return DispatchResponse::Ok();
@@ -1192,6 +1772,9 @@ DispatchResponse DebuggerImpl::Enable([[maybe_unused]] const EnableParams &param
 
 void DebuggerImpl::EnableDebuggerFeatures(const EnableParams &params)
 {
+    // the features are those requested by the last enable, a frontend attaching again may not support them
+    asyncStackTraceId_ = false;
+    batchScriptParsed_ = false;
     if (!params.HasEnableOptionsList()) {
         return;
     }
@@ -1210,6 +1793,12 @@ DebuggerFeature DebuggerImpl::GetDebuggerFeatureEnum(std::string &option)
     if (option == "enableLaunchAccelerate") {
         return DebuggerFeature::LAUNCH_ACCELERATE;
     }
+    if (option == "enableAsyncStackTraceId") {
+        return DebuggerFeature::ASYNC_STACK_TRACE_ID;
+    }
+    if (option == "enableBatchScriptParsed") {
+        return DebuggerFeature::BATCH_SCRIPT_PARSED;
+    }
     // Future features could be added here to parse as DebuggerFeatureEnum
     return DebuggerFeature::UNKNOWN;
 }
@@ -1221,6 +1810,12 @@ void DebuggerImpl::EnableFeature(DebuggerFeature feature)
             EnableLaunchAccelerateMode();
             DebuggerApi::DisableFirstTimeFlag(jsDebugger_);
             break;
+        case DebuggerFeature::ASYNC_STACK_TRACE_ID:
+            asyncStackTraceId_ = true;
+            break;
+        case DebuggerFeature::BATCH_SCRIPT_PARSED:
+            batchScriptParsed_ = true;
+            break;
         default:
             break;
     }
@@ -1229,8 +1824,13 @@ void DebuggerImpl::EnableFeature(DebuggerFeature feature)
 DispatchResponse DebuggerImpl::Disable()
 {
     DebuggerApi::RemoveAllBreakpoints(jsDebugger_);
+    breakpointActions_.clear();
     frontend_.RunIfWaitingForDebugger(vm_);
     frontend_.Resumed(vm_);
+    CleanUpOnResumed();
+    ClearCompiledExpressions();
+    internedAsyncStacks_.clear();
+    asyncStackIds_.clear();
     vm_->GetJsDebuggerManager()->SetDebugMode(false);
     debuggerState_ = DebuggerState::DISABLED;
     return DispatchResponse::Ok();
@@ -1245,6 +1845,7 @@ DispatchResponse DebuggerImpl::EvaluateOnCallFrame(const EvaluateOnCallFramePara
         return DispatchResponse::Fail("Invalid callFrameId.");
     }
 
+    RemoteObjectId firstObjectId = runtime_->curObjectId_;
     std::vector<uint8_t> dest;
     if (!DecodeAndCheckBase64(expression, dest)) {
         LOG_DEBUGGER(ERROR) << "EvaluateValue: base64 decode failed";
@@ -1252,6 +1853,9 @@ DispatchResponse DebuggerImpl::EvaluateOnCallFrame(const EvaluateOnCallFramePara
         if (ret.has_value()) {
             LOG_DEBUGGER(ERROR) << "Evaluate fail, expression: " << expression;
         }
+        if (params.HasObjectGroup()) {
+            runtime_->AddObjectGroup(params.GetObjectGroup(), firstObjectId);
+        }
         return DispatchResponse::Create(ret);
     }
 
@@ -1259,8 +1863,7 @@ DispatchResponse DebuggerImpl::EvaluateOnCallFrame(const EvaluateOnCallFramePara
     Local<JSValueRef> originContext = JSNApi::GetCurrentContext(vm_);
     JSNApi::SwitchContext(vm_, currentContext);
 
-    auto funcRef = DebuggerApi::GenerateFuncFromBuffer(vm_, dest.data(), dest.size(),
-        JSPandaFile::ENTRY_FUNCTION_NAME);
+    auto funcRef = GetCompiledFunc(dest, currentContext);
     auto res = DebuggerApi::EvaluateViaFuncCall(const_cast<EcmaVM *>(vm_), funcRef,
         callFrameHandlers_[callFrameId]);
 
@@ -1277,6 +1880,9 @@ DispatchResponse DebuggerImpl::EvaluateOnCallFrame(const EvaluateOnCallFramePara
 
     *result = RemoteObject::FromTagged(vm_, res);
     runtime_->CacheObjectIfNeeded(res, (*result).get());
+    if (params.HasObjectGroup()) {
+        runtime_->AddObjectGroup(params.GetObjectGroup(), firstObjectId);
+    }
     return DispatchResponse::Ok();
 }
 
@@ -1319,7 +1925,18 @@ DispatchResponse DebuggerImpl::GetScriptSource(const GetScriptSourceParams &para
         *source = "";
         return DispatchResponse::Fail("unknown script id: " + std::to_string(scriptId));
     }
-    *source = iter->second->GetScriptSource();
+    const PtScript &script = *iter->second;
+    if (!script.HasSourceLoader()) {
+        *source = script.GetScriptSource();
+        return DispatchResponse::Ok();
+    }
+    const std::string *cachedSource = scriptSourceCache_.Find(scriptId);
+    if (cachedSource != nullptr) {
+        *source = *cachedSource;
+        return DispatchResponse::Ok();
+    }
+    *source = script.GetScriptSource();
+    scriptSourceCache_.Insert(scriptId, *source);
 
     return DispatchResponse::Ok();
 }
@@ -1359,6 +1976,7 @@ DispatchResponse DebuggerImpl::RemoveBreakpoint(const RemoveBreakpointParams &pa
 
         auto callbackFunc = [this](const JSPtLocation &location) -> bool {
             LOG_DEBUGGER(INFO) << "remove breakpoint location: " << location.ToString();
+            breakpointActions_.erase(GetBreakpointActionKey(location));
             return DebuggerApi::RemoveBreakpoint(jsDebugger_, location);
         };
         if (!extractor->MatchWithLocation(callbackFunc, metaData.line_, metaData.column_,
@@ -1389,6 +2007,13 @@ DispatchResponse DebuggerImpl::RemoveBreakpointsByUrl(const RemoveBreakpointsByU
     if (!DebuggerApi::RemoveBreakpointsByUrl(jsDebugger_, url)) {
         return DispatchResponse::Fail("RemoveBreakpointByUrl failed");
     }
+    for (auto iter = breakpointActions_.begin(); iter != breakpointActions_.end();) {
+        if (iter->second.url == url) {
+            iter = breakpointActions_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
 
     LOG_DEBUGGER(INFO) << "All breakpoints on " << url << " are removed";
     if (IsLaunchAccelerateMode()) {
@@ -1403,6 +2028,7 @@ DispatchResponse DebuggerImpl::Resume([[maybe_unused]] const ResumeParams &param
         return DispatchResponse::Fail("Can only perform operation while paused");
     }
     frontend_.Resumed(vm_);
+    CleanUpOnResumed();
     debuggerState_ = DebuggerState::ENABLED;
     // Reset DYNAMIC_TO_STATIC flag to be false when resuming
     if (isHybrid_) {
@@ -1441,6 +2067,15 @@ DispatchResponse DebuggerImpl::SetBreakpointByUrl(const SetBreakpointByUrlParams
     // it is not support column breakpoint now, so columnNumber is not useful
     int32_t columnNumber = -1;
     auto condition = params.HasCondition() ? params.GetCondition() : std::optional<std::string> {};
+    BreakpointAction action {url};
+    if (params.HasLogMessage()) {
+        action.logMessage = params.GetLogMessage();
+    }
+    if (params.HasHitCondition() && !ParseHitCondition(params.GetHitCondition(), &action)) {
+        LOG_DEBUGGER(ERROR) << "SetBreakpointByUrl: invalid hit condition: " << params.GetHitCondition();
+        return DispatchResponse::Fail("Invalid hitCondition.");
+    }
+    bool hasAction = action.logMessage.has_value() || action.hitConditionType != HitConditionType::NONE;
     *outLocations = std::vector<std::unique_ptr<Location>>();
 
     auto scriptFunc = [](PtScript *) -> bool {
@@ -1458,7 +2093,8 @@ DispatchResponse DebuggerImpl::SetBreakpointByUrl(const SetBreakpointByUrlParams
             continue;
         }
 
-        auto callbackFunc = [this, &condition, &isSmartBreakpoint](const JSPtLocation &location) -> bool {
+        auto callbackFunc = [this, &condition, &isSmartBreakpoint, &action, hasAction](
+            const JSPtLocation &location) -> bool {
             LOG_DEBUGGER(INFO) << "set breakpoint location: " << location.ToString();
             Local<FunctionRef> condFuncRef = FunctionRef::Undefined(vm_);
             if (condition.has_value() && !condition.value().empty()) {
@@ -1468,7 +2104,15 @@ DispatchResponse DebuggerImpl::SetBreakpointByUrl(const SetBreakpointByUrlParams
                     return false;
                 }
             }
-            return DebuggerApi::SetBreakpoint(jsDebugger_, location, condFuncRef, isSmartBreakpoint);
+            if (!DebuggerApi::SetBreakpoint(jsDebugger_, location, condFuncRef, isSmartBreakpoint)) {
+                return false;
+            }
+            if (hasAction) {
+                breakpointActions_[GetBreakpointActionKey(location)] = action;
+            } else {
+                breakpointActions_.erase(GetBreakpointActionKey(location));
+            }
+            return true;
         };
         if (!extractor->MatchWithLocation(callbackFunc, lineNumber, columnNumber, url, GetRecordName(url))) {
             LOG_DEBUGGER(ERROR) << "failed to set breakpoint location number: "
@@ -1497,7 +2141,7 @@ DispatchResponse DebuggerImpl::GetPossibleAndSetBreakpointByUrl(const GetPossibl
     }
     auto breakpointList = params.GetBreakpointsList();
     for (const auto &breakpoint : *breakpointList) {
-        if (!ProcessSingleBreakpoint(*breakpoint, outLocations)) {
+        if (!ProcessSingleBreakpoint(*breakpoint, GetExtractors(breakpoint->GetUrl()), outLocations)) {
             std::string invalidBpId = "invalid";
             std::shared_ptr<BreakpointReturnInfo> bpInfo = std::make_shared<BreakpointReturnInfo>();
             bpInfo->SetId(invalidBpId)
@@ -1572,6 +2216,115 @@ DispatchResponse DebuggerImpl::RemoveSymbolicBreakpoints(const RemoveSymbolicBre
     return DispatchResponse::Ok();
 }
 
+DispatchResponse DebuggerImpl::SetPausedCallFramesLimit(const SetPausedCallFramesLimitParams &params)
+{
+    pausedCallFramesLimit_ = params.GetLimit();
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse DebuggerImpl::GetCallFrames(const GetCallFramesParams &params,
+                                             std::vector<std::unique_ptr<CallFrame>> *callFrames, bool *hasMore)
+{
+    if (debuggerState_ != DebuggerState::PAUSED) {
+        return DispatchResponse::Fail("GetCallFrames: debugger is not paused");
+    }
+    bool isEmptyUnionStack = true;
+    if (isHybrid_) {
+        DebuggerApi::UnionStackIsEmpty(vm_, &isEmptyUnionStack);
+    }
+    if (!isEmptyUnionStack) {
+        return DispatchResponse::Fail("GetCallFrames: not supported in hybrid stack");
+    }
+    // the handlers saved on pause are indexed by call frame id
+    size_t end = callFrameHandlers_.size();
+    size_t start = std::min(static_cast<size_t>(params.GetStart()), end);
+    if (params.HasCount()) {
+        end = std::min(end, start + params.GetCount());
+    }
+    lazyScopeChain_ = true;
+    RemoteObjectId firstObjectId = runtime_->curObjectId_;
+    for (size_t i = start; i < end; i++) {
+        std::unique_ptr<CallFrame> callFrame = std::make_unique<CallFrame>();
+        if (GenerateCallFrame(callFrame.get(), callFrameHandlers_[i].get(), static_cast<CallFrameId>(i), true)) {
+            callFrames->emplace_back(std::move(callFrame));
+        }
+    }
+    runtime_->AddObjectGroup(BACKTRACE_OBJECT_GROUP, firstObjectId);
+    lazyScopeChain_ = false;
+    *hasMore = end < callFrameHandlers_.size();
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse DebuggerImpl::GetStackTrace(const GetStackTraceParams &params,
+                                             std::unique_ptr<StackTrace> *stackTrace)
+{
+    const std::string &id = params.GetStackTraceId()->GetId();
+    auto iter = internedAsyncStacks_.find(id);
+    if (iter == internedAsyncStacks_.end()) {
+        return DispatchResponse::Fail("Unknown stackTraceId.");
+    }
+    std::shared_ptr<AsyncStack> asyncStack = iter->second.asyncStack.lock();
+    if (asyncStack == nullptr) {
+        return DispatchResponse::Fail("The async stack of stackTraceId has been released.");
+    }
+    // GenerateStackTrace may intern the parent and rehash the map
+    int32_t depth = iter->second.depth;
+    *stackTrace = GenerateStackTrace(asyncStack, depth);
+    return DispatchResponse::Ok();
+}
+
+std::string DebuggerImpl::InternAsyncStack(const std::shared_ptr<AsyncStack> &asyncStack, int32_t depth)
+{
+    auto idIter = asyncStackIds_.find(asyncStack.get());
+    if (idIter != asyncStackIds_.end()) {
+        auto &interned = internedAsyncStacks_[idIter->second];
+        // the address may be reused by a new async stack after the old one is released
+        if (interned.asyncStack.lock() == asyncStack) {
+            interned.depth = std::min(interned.depth, depth);
+            return idIter->second;
+        }
+        internedAsyncStacks_.erase(idIter->second);
+        asyncStackIds_.erase(idIter);
+    }
+    if (internedAsyncStacks_.size() >= MAX_INTERNED_ASYNC_STACKS) {
+        SweepInternedAsyncStacks();
+    }
+    std::string id = std::to_string(++curAsyncStackId_);
+    internedAsyncStacks_[id] = {asyncStack, depth};
+    asyncStackIds_[asyncStack.get()] = id;
+    return id;
+}
+
+void DebuggerImpl::SweepInternedAsyncStacks()
+{
+    for (auto iter = asyncStackIds_.begin(); iter != asyncStackIds_.end();) {
+        auto interned = internedAsyncStacks_.find(iter->second);
+        if (interned == internedAsyncStacks_.end() || interned->second.asyncStack.expired()) {
+            if (interned != internedAsyncStacks_.end()) {
+                internedAsyncStacks_.erase(interned);
+            }
+            iter = asyncStackIds_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+std::unique_ptr<StackTrace> DebuggerImpl::GenerateStackTrace(const std::shared_ptr<AsyncStack> &asyncStack,
+                                                             int32_t depth)
+{
+    std::unique_ptr<StackTrace> stackTrace = std::make_unique<StackTrace>();
+    stackTrace->SetDescription(asyncStack->GetDescription()).SetCallFrames(asyncStack->GetFrames());
+    // the segments deeper than setAsyncCallStackDepth are not reachable
+    std::shared_ptr<AsyncStack> parent = asyncStack->GetAsyncParent().lock();
+    if (parent != nullptr && depth < maxAsyncCallChainDepth_) {
+        std::unique_ptr<StackTraceId> parentId = std::make_unique<StackTraceId>();
+        parentId->SetId(InternAsyncStack(parent, depth + 1));
+        stackTrace->SetParentId(std::move(parentId));
+    }
+    return stackTrace;
+}
+
 DispatchResponse DebuggerImpl::SetAsyncCallStackDepth(const SetAsyncCallStackDepthParams &params)
 {
     maxAsyncCallChainDepth_ = params.GetMaxDepth();
@@ -1600,7 +2353,9 @@ void DebuggerImpl::SavePendingBreakpoints(const SaveAllPossibleBreakpointsParams
 }
 
 bool DebuggerImpl::ProcessSingleBreakpoint(const BreakpointInfo &breakpoint,
-                                           std::vector<std::shared_ptr<BreakpointReturnInfo>> &outLocations)
+                                           const std::vector<DebugInfoExtractor *> &extractors,
+                                           std::vector<std::shared_ptr<BreakpointReturnInfo>> &outLocations,
+                                           const JSPandaFile *jsPandaFile)
 {
     const std::string &url = breakpoint.GetUrl();
     int32_t lineNumber = breakpoint.GetLineNumber();
@@ -1618,25 +2373,21 @@ bool DebuggerImpl::ProcessSingleBreakpoint(const BreakpointInfo &breakpoint,
         return false;
     }
 
-    std::vector<DebugInfoExtractor *> extractors = GetExtractors(url);
+    // decode and convert condition to function before doing matchWithLocation
+    Local<FunctionRef> funcRef = FunctionRef::Undefined(vm_);
+    if (!extractors.empty() && condition.has_value() && !condition.value().empty()) {
+        funcRef = CheckAndGenerateCondFunc(condition);
+        if (funcRef->IsUndefined()) {
+            LOG_DEBUGGER(ERROR) << "GetPossibleAndSetBreakpointByUrl: generate function failed";
+            return false;
+        }
+    }
     for (auto extractor : extractors) {
         if (extractor == nullptr) {
             LOG_DEBUGGER(DEBUG) << "GetPossibleAndSetBreakpointByUrl: extractor is null";
             continue;
         }
-        // decode and convert condition to function before doing matchWithLocation
-        Local<FunctionRef> funcRef = FunctionRef::Undefined(vm_);
-        if (condition.has_value() && !condition.value().empty()) {
-            funcRef = CheckAndGenerateCondFunc(condition);
-            if (funcRef->IsUndefined()) {
-                LOG_DEBUGGER(ERROR) << "GetPossibleAndSetBreakpointByUrl: generate function failed";
-                return false;
-            }
-        }
-        auto matchLocationCbFunc = [this, &funcRef](const JSPtLocation &location) -> bool {
-            return DebuggerApi::SetBreakpoint(jsDebugger_, location, funcRef);
-        };
-        if (!extractor->MatchWithLocation(matchLocationCbFunc, lineNumber, columnNumber, url, GetRecordName(url))) {
+        if (!SetBreakpointLocations(extractor, jsPandaFile, url, lineNumber, columnNumber, funcRef)) {
             LOG_DEBUGGER(ERROR) << "failed to set breakpoint location number: " << lineNumber << ":" << columnNumber;
             return false;
         }
@@ -1651,9 +2402,43 @@ bool DebuggerImpl::ProcessSingleBreakpoint(const BreakpointInfo &breakpoint,
     return true;
 }
 
+bool DebuggerImpl::SetBreakpointLocations(DebugInfoExtractor *extractor, const JSPandaFile *jsPandaFile,
+    const std::string &url, int32_t lineNumber, int32_t columnNumber, Local<FunctionRef> funcRef)
+{
+    auto matchLocationCbFunc = [this, &funcRef](const JSPtLocation &location) -> bool {
+        return DebuggerApi::SetBreakpoint(jsDebugger_, location, funcRef);
+    };
+    if (jsPandaFile == nullptr || !breakpointsCache_.IsEnabled()) {
+        return extractor->MatchWithLocation(matchLocationCbFunc, lineNumber, columnNumber, url, GetRecordName(url));
+    }
+    // the cached locations are only found for the checksum of the file they were resolved in
+    uint32_t checksum = jsPandaFile->GetPandaFile()->GetHeader()->checksum;
+    const auto *cachedLocations = breakpointsCache_.Find(checksum, url, lineNumber);
+    if (cachedLocations != nullptr) {
+        for (const auto &cachedLocation : *cachedLocations) {
+            JSPtLocation location(jsPandaFile, panda_file::File::EntityId(cachedLocation.methodId),
+                cachedLocation.offset);
+            if (!matchLocationCbFunc(location)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    std::vector<BreakpointCacheLocation> locations;
+    auto resolveLocationCbFunc = [&matchLocationCbFunc, &locations](const JSPtLocation &location) -> bool {
+        locations.push_back({location.GetMethodId().GetOffset(), location.GetBytecodeOffset()});
+        return matchLocationCbFunc(location);
+    };
+    if (!extractor->MatchWithLocation(resolveLocationCbFunc, lineNumber, columnNumber, url, GetRecordName(url))) {
+        return false;
+    }
+    breakpointsCache_.Insert(checksum, url, lineNumber, locations);
+    return true;
+}
+
 DispatchResponse DebuggerImpl::SetNativeRange(const SetNativeRangeParams &params)
 {
-    nativeRanges_ = params.GetNativeRange();
+    nativeRanges_ = MergeNativeRanges(params.GetNativeRange());
     return DispatchResponse::Ok();
 }
 
@@ -1668,7 +2453,17 @@ DispatchResponse DebuggerImpl::ResetSingleStepper(const ResetSingleStepperParams
 
 DispatchResponse DebuggerImpl::SetPauseOnExceptions(const SetPauseOnExceptionsParams &params)
 {
+    std::vector<std::string> urlPatterns;
+    for (const auto &pattern : params.GetUrlPatterns()) {
+        if (!ParseBlackboxPattern(pattern, &urlPatterns)) {
+            return DispatchResponse::Fail("Unsupported url pattern: " + pattern);
+        }
+    }
     pauseOnException_ = params.GetState();
+    exceptionErrorNames_ = {params.GetErrorNames().begin(), params.GetErrorNames().end()};
+    exceptionUrlPatterns_ = std::move(urlPatterns);
+    exceptionThrowsPerPause_ = params.GetThrowsPerPause();
+    exceptionSiteThrows_.clear();
     return DispatchResponse::Ok();
 }
 
@@ -1689,6 +2484,7 @@ DispatchResponse DebuggerImpl::StepInto([[maybe_unused]] const StepIntoParams &p
         return DispatchResponse::Fail("Failed to StepInto");
     }
     frontend_.Resumed(vm_);
+    CleanUpOnResumed();
     debuggerState_ = DebuggerState::ENABLED;
     // Set DYNAMIC_TO_STATIC flag to be true in order for
     // static side to pause when stepping from dynamic to static
@@ -1719,6 +2515,7 @@ DispatchResponse DebuggerImpl::StepOut()
         return DispatchResponse::Fail("Failed to StepOut");
     }
     frontend_.Resumed(vm_);
+    CleanUpOnResumed();
     debuggerState_ = DebuggerState::ENABLED;
     // Set DYNAMIC_TO_STATIC flag to be true in order for
     // static side to pause when stepping from dynamic to static
@@ -1739,13 +2536,165 @@ DispatchResponse DebuggerImpl::StepOver([[maybe_unused]] const StepOverParams &p
         return DispatchResponse::Fail("Failed to StepOver");
     }
     frontend_.Resumed(vm_);
+    CleanUpOnResumed();
     debuggerState_ = DebuggerState::ENABLED;
     return DispatchResponse::Ok();
 }
 
-DispatchResponse DebuggerImpl::SetBlackboxPatterns()
+DispatchResponse DebuggerImpl::SetBlackboxPatterns(const SetBlackboxPatternsParams &params)
+{
+    std::vector<std::string> blackboxPatterns;
+    for (const auto &pattern : params.GetPatterns()) {
+        if (!ParseBlackboxPattern(pattern, &blackboxPatterns)) {
+            return DispatchResponse::Fail("Unsupported blackbox pattern: " + pattern);
+        }
+    }
+    blackboxPatterns_ = std::move(blackboxPatterns);
+    // the scripts parsed later are resolved as they are added
+    for (const auto &item : scripts_) {
+        item.second->SetBlackboxed(MatchBlackboxPatterns(blackboxPatterns_, item.second->GetUrl()));
+    }
+    methodBlackboxes_.clear();
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse DebuggerImpl::SetBlackboxedRanges(const SetBlackboxedRangesParams &params)
+{
+    auto iter = scripts_.find(params.GetScriptId());
+    if (iter == scripts_.end()) {
+        return DispatchResponse::Fail("unknown script id: " + std::to_string(params.GetScriptId()));
+    }
+    std::vector<std::pair<int32_t, int32_t>> ranges;
+    for (const auto &position : *params.GetPositions()) {
+        std::pair<int32_t, int32_t> current {position->GetLine(), position->GetColumn()};
+        if (!ranges.empty() && current < ranges.back()) {
+            return DispatchResponse::Fail("Input positions array is not sorted");
+        }
+        ranges.emplace_back(current);
+    }
+    iter->second->SetBlackboxedRanges(std::move(ranges));
+    methodBlackboxes_.clear();
+    hasBlackboxedRanges_ = std::any_of(scripts_.begin(), scripts_.end(), [](const auto &item) {
+        return !item.second->GetBlackboxedRanges().empty();
+    });
+    return DispatchResponse::Ok();
+}
+
+// A blackbox pattern is a regular expression of urls. The literals, the escapes, '.', the quantifiers
+// '*', '+' and '?', the anchors '^' and '$' and the alternatives of '|' are supported, groups, classes
+// and counted repetitions are not
+bool DebuggerImpl::ParseBlackboxPattern(const std::string &pattern, std::vector<std::string> *alternatives)
+{
+    std::string alternative;
+    bool hasAtom = false;
+    for (size_t i = 0; i <= pattern.size(); i++) {
+        if (i == pattern.size() || pattern[i] == '|') {
+            // an empty alternative would blackbox every script
+            if (!alternative.empty() && alternative != "^" && alternative != "$") {
+                alternatives->emplace_back(std::move(alternative));
+            }
+            alternative.clear();
+            hasAtom = false;
+            continue;
+        }
+        char c = pattern[i];
+        if (c == '\\') {
+            if (i + 1 == pattern.size()) {
+                return false;
+            }
+            alternative.append(pattern, i++, 2);  // 2: the backslash and the escaped character
+            hasAtom = true;
+            continue;
+        }
+        if (c == '^') {
+            if (!alternative.empty()) {
+                return false;
+            }
+            hasAtom = false;
+        } else if (c == '$') {
+            if (i + 1 != pattern.size() && pattern[i + 1] != '|') {
+                return false;
+            }
+            hasAtom = false;
+        } else if (c == '*' || c == '+' || c == '?') {
+            if (!hasAtom) {
+                return false;
+            }
+            hasAtom = false;
+        } else if (std::string_view("()[]{}").find(c) != std::string_view::npos) {
+            return false;
+        } else {
+            hasAtom = true;
+        }
+        alternative += c;
+    }
+    return true;
+}
+
+bool DebuggerImpl::MatchBlackboxAtom(const std::string &alternative, size_t patternPos, char c)
+{
+    if (alternative[patternPos] == '.') {
+        return true;
+    }
+    if (alternative[patternPos] != '\\') {
+        return alternative[patternPos] == c;
+    }
+    switch (alternative[patternPos + 1]) {
+        case 'd':
+            return std::isdigit(static_cast<unsigned char>(c));
+        case 'w':
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+        case 's':
+            return std::isspace(static_cast<unsigned char>(c));
+        default:
+            return alternative[patternPos + 1] == c;
+    }
+}
+
+bool DebuggerImpl::MatchBlackboxAlternative(const std::string &alternative, size_t patternPos,
+    const std::string &url, size_t urlPos)
+{
+    if (patternPos == alternative.size()) {
+        return true;
+    }
+    if (alternative[patternPos] == '$' && patternPos + 1 == alternative.size()) {
+        return urlPos == url.size();
+    }
+    size_t atomEnd = patternPos + (alternative[patternPos] == '\\' ? 2 : 1);  // 2: an escape
+    char quantifier = atomEnd < alternative.size() ? alternative[atomEnd] : '\0';
+    if (quantifier != '*' && quantifier != '+' && quantifier != '?') {
+        return urlPos < url.size() && MatchBlackboxAtom(alternative, patternPos, url[urlPos]) &&
+            MatchBlackboxAlternative(alternative, atomEnd, url, urlPos + 1);
+    }
+    size_t minCount = quantifier == '+' ? 1 : 0;
+    size_t maxCount = quantifier == '?' ? std::min<size_t>(1, url.size() - urlPos) : url.size() - urlPos;
+    size_t count = 0;
+    while (count < maxCount && MatchBlackboxAtom(alternative, patternPos, url[urlPos + count])) {
+        count++;
+    }
+    // greedy, the longest repetition first
+    for (size_t n = count + 1; n-- > minCount;) {
+        if (MatchBlackboxAlternative(alternative, atomEnd + 1, url, urlPos + n)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DebuggerImpl::MatchBlackboxPatterns(const std::vector<std::string> &alternatives, const std::string &url)
 {
-    return DispatchResponse::Fail("SetBlackboxPatterns not support now");
+    for (const auto &alternative : alternatives) {
+        bool anchored = alternative[0] == '^';
+        for (size_t urlPos = 0; urlPos <= url.size(); urlPos++) {
+            if (MatchBlackboxAlternative(alternative, anchored ? 1 : 0, url, urlPos)) {
+                return true;
+            }
+            if (anchored) {
+                break;
+            }
+        }
+    }
+    return false;
 }
 
 DispatchResponse DebuggerImpl::SetMixedDebugEnabled([[maybe_unused]] const SetMixedDebugParams &params)
@@ -1806,7 +2755,7 @@ DispatchResponse DebuggerImpl::DropFrame(const DropFrameParams &params)
     return DispatchResponse::Ok();
 }
 
-DispatchResponse DebuggerImpl::CallFunctionOn([[maybe_unused]] const CallFunctionOnParams &params,
+DispatchResponse DebuggerImpl::CallFunctionOn(const CallFunctionOnParams &params,
     std::unique_ptr<RemoteObject> *outRemoteObject,
     [[maybe_unused]] std::optional<std::unique_ptr<ExceptionDetails>> *outExceptionDetails)
 {
@@ -1823,8 +2772,7 @@ DispatchResponse DebuggerImpl::CallFunctionOn([[maybe_unused]] const CallFunctio
         return DispatchResponse::Fail("base64 decode failed, functionDeclaration: " +
             functionDeclaration);
     }
-    auto funcRef = DebuggerApi::GenerateFuncFromBuffer(vm_, dest.data(), dest.size(),
-        JSPandaFile::ENTRY_FUNCTION_NAME);
+    auto funcRef = GetCompiledFunc(dest, JSNApi::GetCurrentContext(vm_));
     // call function
     auto res = DebuggerApi::CallFunctionOnCall(const_cast<EcmaVM *>(vm_), funcRef,
         callFrameHandlers_[callFrameId]);
@@ -1837,8 +2785,12 @@ DispatchResponse DebuggerImpl::CallFunctionOn([[maybe_unused]] const CallFunctio
         return DispatchResponse::Fail(msg);
     }
 
+    RemoteObjectId firstObjectId = runtime_->curObjectId_;
     *outRemoteObject = RemoteObject::FromTagged(vm_, res);
     runtime_->CacheObjectIfNeeded(res, (*outRemoteObject).get());
+    if (params.HasObjectGroup()) {
+        runtime_->AddObjectGroup(params.GetObjectGroup(), firstObjectId);
+    }
     return DispatchResponse::Ok();
 }
 
@@ -1847,20 +2799,25 @@ void DebuggerImpl::CleanUpOnPaused()
     CleanUpRuntimeProperties();
     callFrameHandlers_.clear();
     scopeObjects_.clear();
+    lazyScopes_.clear();
 }
 
-void DebuggerImpl::CleanUpRuntimeProperties()
+void DebuggerImpl::CleanUpOnResumed()
 {
-    LOG_DEBUGGER(INFO) << "CleanUpRuntimeProperties OnPaused";
-    if (runtime_->properties_.empty()) {
+    if (runtime_ == nullptr) {
         return;
     }
-    RemoteObjectId validObjId = runtime_->curObjectId_ - 1;
-    for (; validObjId >= 0; validObjId--) {
-        runtime_->properties_[validObjId].FreeGlobalHandleAddr();
-    }
-    runtime_->curObjectId_ = 0;
-    runtime_->properties_.clear();
+    // the frontend drops the call frames on resumed, the objects handed out for them are released as well
+    runtime_->FreeObjectGroup(BACKTRACE_OBJECT_GROUP);
+    callFrameHandlers_.clear();
+    scopeObjects_.clear();
+    lazyScopes_.clear();
+}
+
+void DebuggerImpl::CleanUpRuntimeProperties()
+{
+    LOG_DEBUGGER(INFO) << "CleanUpRuntimeProperties OnPaused";
+    runtime_->FreeAllObjects();
 }
 
 std::string DebuggerImpl::Trim(const std::string &str)
@@ -1906,14 +2863,21 @@ std::vector<DebugInfoExtractor *> DebuggerImpl::GetExtractors(const std::string
     return extractors;
 }
 
-bool DebuggerImpl::GenerateCallFrames(std::vector<std::unique_ptr<CallFrame>> *callFrames, bool getScope)
+bool DebuggerImpl::GenerateCallFrames(std::vector<std::unique_ptr<CallFrame>> *callFrames, bool getScope,
+                                      uint32_t maxCount)
 {
     CallFrameId callFrameId = 0;
-    auto walkerFunc = [this, &callFrameId, &callFrames, &getScope](const FrameHandler *frameHandler) -> StackState {
+    auto walkerFunc = [this, &callFrameId, &callFrames, &getScope, maxCount](
+        const FrameHandler *frameHandler) -> StackState {
         if (DebuggerApi::IsNativeMethod(frameHandler)) {
             LOG_DEBUGGER(INFO) << "GenerateCallFrames: Skip CFrame and Native method";
             return StackState::CONTINUE;
         }
+        // the frames after the first maxCount ones are only generated when they are requested
+        if (maxCount != 0 && callFrames->size() >= maxCount) {
+            SaveCallFrameHandler(frameHandler);
+            return StackState::CONTINUE;
+        }
         std::unique_ptr<CallFrame> callFrame = std::make_unique<CallFrame>();
         if (!GenerateCallFrame(callFrame.get(), frameHandler, callFrameId, getScope)) {
             if (callFrameId == 0) {
@@ -2269,18 +3233,24 @@ std::unique_ptr<Scope> DebuggerImpl::GetLocalScopeChain(const FrameHandler *fram
     auto *sp = DebuggerApi::GetSp(frameHandler);
     scopeObjects_[sp][Scope::Type::Local()].push_back(runtime_->curObjectId_);
     DebuggerApi::AddInternalProperties(vm_, localObj, ArkInternalValueType::Scope,  runtime_->internalObjects_);
-    runtime_->properties_[runtime_->curObjectId_++] = Global<JSValueRef>(vm_, localObj);
+    RemoteObjectId localObjId = runtime_->curObjectId_++;
+    runtime_->properties_[localObjId] = Global<JSValueRef>(vm_, localObj);
 
     Local<JSValueRef> thisVal = JSNApiHelper::ToLocal<JSValueRef>(
         JSHandle<JSTaggedValue>(vm_->GetJSThread(), JSTaggedValue::Hole()));
-    GetLocalVariables(frameHandler, methodId, jsPandaFile, thisVal, localObj);
+    if (lazyScopeChain_) {
+        thisVal = GetLocalThis(frameHandler, methodId, jsPandaFile);
+        AddLazyScope(localObjId, frameHandler, Scope::Type::Local());
+    } else {
+        GetLocalVariables(frameHandler, methodId, jsPandaFile, thisVal, localObj);
+    }
     *thisObj = RemoteObject::FromTagged(vm_, thisVal);
     runtime_->CacheObjectIfNeeded(thisVal, (*thisObj).get());
 
     const LineNumberTable &lines = extractor->GetLineNumberTable(methodId);
     std::unique_ptr<Location> startLoc = std::make_unique<Location>();
     std::unique_ptr<Location> endLoc = std::make_unique<Location>();
-    auto scriptFunc = [&startLoc, &endLoc, lines](PtScript *script) -> bool {
+    auto scriptFunc = [&startLoc, &endLoc, &lines](PtScript *script) -> bool {
         startLoc->SetScriptId(script->GetScriptId())
             .SetLine(lines.front().line)
             .SetColumn(0);
@@ -2316,7 +3286,6 @@ std::vector<std::unique_ptr<Scope>> DebuggerImpl::GetClosureScopeChains(const Fr
 
     JSMutableHandle<JSTaggedValue> envHandle = JSMutableHandle<JSTaggedValue>(
         thread, DebuggerApi::GetEnv(frameHandler));
-    JSMutableHandle<JSTaggedValue> valueHandle = JSMutableHandle<JSTaggedValue>(thread, JSTaggedValue::Hole());
     JSTaggedValue currentEnv = envHandle.GetTaggedValue();
     if (!currentEnv.IsLexicalEnv()) {
         LOG_DEBUGGER(DEBUG) << "GetClosureScopeChains: currentEnv is invalid";
@@ -2324,56 +3293,21 @@ std::vector<std::unique_ptr<Scope>> DebuggerImpl::GetClosureScopeChains(const Fr
     }
     // check if GetLocalScopeChain has already found and set 'this' value
     bool thisFound = (*thisObj)->HasValue();
-    bool closureVarFound = false;
+    uint32_t envDepth = 0;
     // currentEnv = currentEnv->parent until currentEnv is not lexicalEnv
     for (; currentEnv.IsLexicalEnv();
-         currentEnv = LexicalEnv::Cast(currentEnv.GetTaggedObject())->GetParentEnv(thread)) {
-        LexicalEnv *lexicalEnv = LexicalEnv::Cast(currentEnv.GetTaggedObject());
+         currentEnv = LexicalEnv::Cast(currentEnv.GetTaggedObject())->GetParentEnv(thread), envDepth++) {
         envHandle.Update(currentEnv);
-        if (lexicalEnv->GetScopeInfo(thread).IsHole()) {
+        if (LexicalEnv::Cast(currentEnv.GetTaggedObject())->GetScopeInfo(thread).IsHole()) {
             continue;
         }
         auto closureScope = std::make_unique<Scope>();
-        auto result = JSNativePointer::Cast(lexicalEnv->GetScopeInfo(thread).GetTaggedObject())->GetExternalPointer();
-        ScopeDebugInfo *scopeDebugInfo = reinterpret_cast<ScopeDebugInfo *>(result);
         std::unique_ptr<RemoteObject> closure = std::make_unique<RemoteObject>();
         Local<ObjectRef> closureScopeObj = ObjectRef::New(vm_);
-
-        std::unordered_map<CString, int> nameCount;
-        for (const auto &[name, slot] : scopeDebugInfo->scopeInfo) {
-            if (IsVariableSkipped(name.c_str())) {
-                continue;
-            }
-            currentEnv = envHandle.GetTaggedValue();
-            lexicalEnv = LexicalEnv::Cast(currentEnv.GetTaggedObject());
-            valueHandle.Update(lexicalEnv->GetProperties(thread, slot));
-            Local<JSValueRef> value = JSNApiHelper::ToLocal<JSValueRef>(valueHandle);
-            Local<JSValueRef> varName = StringRef::NewFromUtf8(vm_, name.c_str());
-            nameCount[name]++;
-            if (nameCount[name] > 1) {
-                CString fullName = name + "$" + ToCString(slot);
-                varName = StringRef::NewFromUtf8(vm_, fullName.c_str());
-            }
-            // found 'this' and 'this' is not set in GetLocalScopechain
-            if (!thisFound && name == "this") {
-                *thisObj = RemoteObject::FromTagged(vm_, value);
-                // cache 'this' object
-                runtime_->CacheObjectIfNeeded(value, (*thisObj).get());
-                thisFound = true;
-                continue;
-            }
-            // found closure variable in current lexenv
-            closureVarFound = true;
-            // if value is hole, should manually set it to undefined
-            // otherwise after DefineProperty, corresponding varName
-            // will become undefined
-            if (value->IsHole()) {
-                valueHandle.Update(JSTaggedValue::Undefined());
-                value = JSNApiHelper::ToLocal<JSValueRef>(valueHandle);
-            }
-            PropertyAttribute descriptor(value, true, true, true);
-            closureScopeObj->DefineProperty(vm_, varName, descriptor);
-        }
+        bool thisFoundBefore = thisFound;
+        // only look for 'this' and whether there is any closure variable if the scope is filled lazily
+        bool closureVarFound = GetClosureVariables(envHandle, lazyScopeChain_ ? nullptr : &closureScopeObj,
+                                                   &thisFound, thisObj);
         // at least one closure variable has been found
         if (closureVarFound) {
             closure->SetType(ObjectType::Object)
@@ -2390,16 +3324,78 @@ std::vector<std::unique_ptr<Scope>> DebuggerImpl::GetClosureScopeChains(const Fr
                     vm_, closureScopeObj, ArkInternalValueType::Scope,  runtime_->internalObjects_);
                 auto *sp = DebuggerApi::GetSp(frameHandler);
                 scopeObjects_[sp][Scope::Type::Closure()].push_back(runtime_->curObjectId_);
+                if (lazyScopeChain_) {
+                    AddLazyScope(runtime_->curObjectId_, frameHandler, Scope::Type::Closure(), envDepth,
+                                 !thisFoundBefore && thisFound);
+                }
                 runtime_->properties_[runtime_->curObjectId_++] = Global<JSValueRef>(vm_, closureScopeObj);
                 closureScopes.emplace_back(std::move(closureScope));
             }
         }
         currentEnv = envHandle.GetTaggedValue();
-        closureVarFound = false;
     }
     return closureScopes;
 }
 
+// Define the variables of the lexical env on closureScopeObj, or only look for them if closureScopeObj is null.
+// 'this' is taken as the 'this' of the frame instead if it has not been found.
+bool DebuggerImpl::GetClosureVariables(const JSHandle<JSTaggedValue> &envHandle, Local<ObjectRef> *closureScopeObj,
+    bool *thisFound, std::unique_ptr<RemoteObject> *thisObj)
+{
+    JSThread *thread = vm_->GetJSThread();
+    JSMutableHandle<JSTaggedValue> valueHandle = JSMutableHandle<JSTaggedValue>(thread, JSTaggedValue::Hole());
+    LexicalEnv *lexicalEnv = LexicalEnv::Cast(envHandle->GetTaggedObject());
+    auto result = JSNativePointer::Cast(lexicalEnv->GetScopeInfo(thread).GetTaggedObject())->GetExternalPointer();
+    ScopeDebugInfo *scopeDebugInfo = reinterpret_cast<ScopeDebugInfo *>(result);
+    bool closureVarFound = false;
+    std::unordered_map<CString, int> nameCount;
+    for (const auto &[name, slot] : scopeDebugInfo->scopeInfo) {
+        if (IsVariableSkipped(name.c_str())) {
+            continue;
+        }
+        nameCount[name]++;
+        // found 'this' and 'this' is not set in GetLocalScopechain
+        if (!*thisFound && name == "this") {
+            if (thisObj != nullptr) {
+                lexicalEnv = LexicalEnv::Cast(envHandle->GetTaggedObject());
+                valueHandle.Update(lexicalEnv->GetProperties(thread, slot));
+                Local<JSValueRef> value = JSNApiHelper::ToLocal<JSValueRef>(valueHandle);
+                *thisObj = RemoteObject::FromTagged(vm_, value);
+                // cache 'this' object
+                runtime_->CacheObjectIfNeeded(value, (*thisObj).get());
+            }
+            *thisFound = true;
+            continue;
+        }
+        // found closure variable in current lexenv
+        closureVarFound = true;
+        if (closureScopeObj == nullptr) {
+            if (*thisFound) {
+                break;
+            }
+            continue;
+        }
+        lexicalEnv = LexicalEnv::Cast(envHandle->GetTaggedObject());
+        valueHandle.Update(lexicalEnv->GetProperties(thread, slot));
+        Local<JSValueRef> value = JSNApiHelper::ToLocal<JSValueRef>(valueHandle);
+        Local<JSValueRef> varName = StringRef::NewFromUtf8(vm_, name.c_str());
+        if (nameCount[name] > 1) {
+            CString fullName = name + "$" + ToCString(slot);
+            varName = StringRef::NewFromUtf8(vm_, fullName.c_str());
+        }
+        // if value is hole, should manually set it to undefined
+        // otherwise after DefineProperty, corresponding varName
+        // will become undefined
+        if (value->IsHole()) {
+            valueHandle.Update(JSTaggedValue::Undefined());
+            value = JSNApiHelper::ToLocal<JSValueRef>(valueHandle);
+        }
+        PropertyAttribute descriptor(value, true, true, true);
+        (*closureScopeObj)->DefineProperty(vm_, varName, descriptor);
+    }
+    return closureVarFound;
+}
+
 std::unique_ptr<Scope> DebuggerImpl::GetModuleScopeChain(const FrameHandler *frameHandler)
 {
     auto moduleScope = std::make_unique<Scope>();
@@ -2414,6 +3410,11 @@ std::unique_ptr<Scope> DebuggerImpl::GetModuleScopeChain(const FrameHandler *fra
     DebuggerApi::AddInternalProperties(vm_, moduleObj, ArkInternalValueType::Scope,  runtime_->internalObjects_);
     auto *sp = DebuggerApi::GetSp(frameHandler);
     scopeObjects_[sp][Scope::Type::Module()].push_back(runtime_->curObjectId_);
+    if (lazyScopeChain_) {
+        AddLazyScope(runtime_->curObjectId_, frameHandler, Scope::Type::Module());
+        runtime_->properties_[runtime_->curObjectId_++] = Global<JSValueRef>(vm_, moduleObj);
+        return moduleScope;
+    }
     runtime_->properties_[runtime_->curObjectId_++] = Global<JSValueRef>(vm_, moduleObj);
     JSThread *thread = vm_->GetJSThread();
     JSHandle<JSTaggedValue> currentModule(thread, DebuggerApi::GetCurrentModule(vm_));
@@ -2465,6 +3466,76 @@ void DebuggerImpl::GetLocalVariables(const FrameHandler *frameHandler, panda_fil
     }
 }
 
+Local<JSValueRef> DebuggerImpl::GetLocalThis(const FrameHandler *frameHandler, panda_file::File::EntityId methodId,
+    const JSPandaFile *jsPandaFile)
+{
+    // the same 'this' as GetLocalVariables finds, without reading the other variables
+    Local<JSValueRef> thisVal = JSNApiHelper::ToLocal<JSValueRef>(
+        JSHandle<JSTaggedValue>(vm_->GetJSThread(), JSTaggedValue::Hole()));
+    auto *extractor = GetExtractor(jsPandaFile);
+    uint32_t bcOffset = DebuggerApi::GetBytecodeOffset(frameHandler);
+    for (const auto &localVariableInfo : extractor->GetLocalVariableTable(methodId)) {
+        if (localVariableInfo.name == "this" && IsWithinVariableScope(localVariableInfo, bcOffset)) {
+            thisVal = DebuggerApi::GetVRegValue(vm_, frameHandler, localVariableInfo.regNumber);
+        }
+    }
+    return thisVal;
+}
+
+void DebuggerImpl::AddLazyScope(RemoteObjectId objectId, const FrameHandler *frameHandler, const std::string &type,
+    uint32_t envDepth, bool skipThis)
+{
+    auto handlerPtr = DebuggerApi::NewFrameHandler(vm_);
+    *handlerPtr = *frameHandler;
+    lazyScopes_[objectId] = LazyScope {handlerPtr, type, envDepth, skipThis};
+}
+
+void DebuggerImpl::MaterializeScope(RemoteObjectId objectId)
+{
+    auto iter = lazyScopes_.find(objectId);
+    if (iter == lazyScopes_.end()) {
+        return;
+    }
+    LazyScope lazyScope = std::move(iter->second);
+    lazyScopes_.erase(iter);
+    // the frames of the scopes have gone after resuming
+    if (debuggerState_ != DebuggerState::PAUSED) {
+        LOG_DEBUGGER(ERROR) << "MaterializeScope: not paused, scope: " << objectId;
+        return;
+    }
+    auto propIter = runtime_->properties_.find(objectId);
+    if (propIter == runtime_->properties_.end()) {
+        return;
+    }
+
+    LOG_DEBUGGER(DEBUG) << "MaterializeScope: " << lazyScope.type << " scope: " << objectId;
+    Local<ObjectRef> scopeObj = propIter->second.ToLocal(vm_);
+    const FrameHandler *frameHandler = lazyScope.frameHandler.get();
+    JSThread *thread = vm_->GetJSThread();
+    if (lazyScope.type == Scope::Type::Local()) {
+        Method *method = DebuggerApi::GetMethod(frameHandler);
+        Local<JSValueRef> thisVal = JSValueRef::Undefined(vm_);
+        GetLocalVariables(frameHandler, method->GetMethodId(), method->GetJSPandaFile(thread), thisVal, scopeObj);
+    } else if (lazyScope.type == Scope::Type::Closure()) {
+        JSMutableHandle<JSTaggedValue> envHandle = JSMutableHandle<JSTaggedValue>(
+            thread, DebuggerApi::GetEnv(frameHandler));
+        for (uint32_t depth = 0; depth < lazyScope.envDepth && envHandle->IsLexicalEnv(); depth++) {
+            envHandle.Update(LexicalEnv::Cast(envHandle->GetTaggedObject())->GetParentEnv(thread));
+        }
+        if (!envHandle->IsLexicalEnv()) {
+            LOG_DEBUGGER(ERROR) << "MaterializeScope: lexical env not found, depth: " << lazyScope.envDepth;
+            return;
+        }
+        bool thisFound = !lazyScope.skipThis;
+        GetClosureVariables(envHandle, &scopeObj, &thisFound, nullptr);
+    } else if (lazyScope.type == Scope::Type::Module()) {
+        JSHandle<JSTaggedValue> currentModule(thread, DebuggerApi::GetCurrentModule(vm_));
+        DebuggerApi::GetLocalExportVariables(vm_, scopeObj, currentModule, false);
+        DebuggerApi::GetIndirectExportVariables(vm_, scopeObj, currentModule);
+        DebuggerApi::GetImportVariables(vm_, scopeObj, currentModule);
+    }
+}
+
 bool DebuggerImpl::IsWithinVariableScope(const LocalVariableInfo &localVariableInfo, uint32_t bcOffset)
 {
     return bcOffset >= localVariableInfo.startOffset && bcOffset < localVariableInfo.endOffset;
@@ -2505,7 +3576,12 @@ void DebuggerImpl::UpdateScopeObject(const FrameHandler *frameHandler,
     }
 
     for (auto objectId : scopeObjects_[sp][scope]) {
-        Local<ObjectRef> localObj = runtime_->properties_[objectId].ToLocal(vm_);
+        MaterializeScope(objectId);
+        auto propIter = runtime_->properties_.find(objectId);
+        if (propIter == runtime_->properties_.end()) {
+            continue;
+        }
+        Local<ObjectRef> localObj = propIter->second.ToLocal(vm_);
         Local<JSValueRef> name = StringRef::NewFromUtf8(vm_, varName.data());
         if (localObj->Has(vm_, name)) {
             LOG_DEBUGGER(DEBUG) << "UpdateScopeObject: set new value";
@@ -2617,8 +3693,7 @@ Local<FunctionRef> DebuggerImpl::CheckAndGenerateCondFunc(const std::optional<st
 {
     std::vector<uint8_t> dest;
     if (DecodeAndCheckBase64(condition.value(), dest)) {
-        Local<FunctionRef> funcRef =
-            DebuggerApi::GenerateFuncFromBuffer(vm_, dest.data(), dest.size(), JSPandaFile::ENTRY_FUNCTION_NAME);
+        Local<FunctionRef> funcRef = GetCompiledFunc(dest, JSNApi::GetCurrentContext(vm_));
         if (!funcRef->IsUndefined()) {
             return funcRef;
         }
@@ -2626,6 +3701,40 @@ Local<FunctionRef> DebuggerImpl::CheckAndGenerateCondFunc(const std::optional<st
     return FunctionRef::Undefined(vm_);
 }
 
+Local<FunctionRef> DebuggerImpl::GetCompiledFunc(const std::vector<uint8_t> &buffer, Local<JSValueRef> context)
+{
+    std::string key(buffer.begin(), buffer.end());
+    auto iter = compiledExpressions_.find(key);
+    if (iter != compiledExpressions_.end() && iter->second.context.ToLocal(vm_)->IsStrictEquals(vm_, context)) {
+        return iter->second.func.ToLocal(vm_);
+    }
+    Local<FunctionRef> funcRef =
+        DebuggerApi::GenerateFuncFromBuffer(vm_, buffer.data(), buffer.size(), JSPandaFile::ENTRY_FUNCTION_NAME);
+    if (funcRef->IsUndefined()) {
+        return funcRef;
+    }
+    if (iter != compiledExpressions_.end()) {
+        // compiled in another global env, the entry is taken over by the current one
+        iter->second.context.FreeGlobalHandleAddr();
+        iter->second.func.FreeGlobalHandleAddr();
+        compiledExpressions_.erase(iter);
+    } else if (compiledExpressions_.size() >= MAX_COMPILED_EXPRESSIONS) {
+        ClearCompiledExpressions();
+    }
+    compiledExpressions_.emplace(std::move(key),
+        CompiledExpression {Global<JSValueRef>(vm_, context), Global<FunctionRef>(vm_, funcRef)});
+    return funcRef;
+}
+
+void DebuggerImpl::ClearCompiledExpressions()
+{
+    for (auto &expression : compiledExpressions_) {
+        expression.second.context.FreeGlobalHandleAddr();
+        expression.second.func.FreeGlobalHandleAddr();
+    }
+    compiledExpressions_.clear();
+}
+
 void DebuggerImpl::SetDebuggerAccessor(const JSHandle<GlobalEnv> &globalEnv)
 {
     Local<JSValueRef> global = JSNApiHelper::ToLocal<JSValueRef>(JSHandle<JSTaggedValue>(globalEnv));
@@ -16,8 +16,13 @@
 #ifndef ECMASCRIPT_TOOLING_AGENT_DEBUGGER_IMPL_H
 #define ECMASCRIPT_TOOLING_AGENT_DEBUGGER_IMPL_H
 
+#include <map>
+#include <tuple>
+
 #include "agent/runtime_impl.h"
 #include "backend/js_pt_hooks.h"
+#include "tooling/dynamic/base/pt_breakpoint_cache.h"
+#include "tooling/dynamic/base/pt_debug_info_cache.h"
 #include "tooling/dynamic/base/pt_params.h"
 #include "backend/js_single_stepper.h"
 #include "dispatcher.h"
@@ -34,7 +39,7 @@ class TestHooks;
 }  // namespace test
 
 enum class DebuggerState { DISABLED, ENABLED, PAUSED };
-enum class DebuggerFeature { LAUNCH_ACCELERATE, UNKNOWN };
+enum class DebuggerFeature { LAUNCH_ACCELERATE, ASYNC_STACK_TRACE_ID, BATCH_SCRIPT_PARSED, UNKNOWN };
 class DebuggerImpl final {
 public:
     DebuggerImpl(const EcmaVM *vm, ProtocolChannel *channel, RuntimeImpl *runtime, bool isHybrid = false);
@@ -45,7 +50,14 @@ public:
                             std::string_view entryPoint = "func_main_0");
     bool NotifyScriptParsedBySendable(JSHandle<Method> method);
     bool NotifySingleStep(const JSPtLocation &location);
+    // whether NotifySingleStep has a step to complete, otherwise it returns without creating any handle
+    bool IsStepping() const
+    {
+        return pauseOnNextByteCode_ || singleStepper_ != nullptr;
+    }
     void NotifyPaused(std::optional<JSPtLocation> location, PauseReason reason);
+    void NotifyException(const JSPtLocation &location);
+    bool NotifyBreakpointHit(const JSPtLocation &location);
     bool NotifyNativeOut();
     void NotifyHandleProtocolCommand();
     void NotifyNativeCalling(const void *nativeAddress);
@@ -86,6 +98,7 @@ public:
     DispatchResponse GetPossibleBreakpoints(const GetPossibleBreakpointsParams &params,
                                             std::vector<std::unique_ptr<BreakLocation>> *outLocations);
     DispatchResponse GetScriptSource(const GetScriptSourceParams &params, std::string *source);
+    DispatchResponse GetStackTrace(const GetStackTraceParams &params, std::unique_ptr<StackTrace> *stackTrace);
     DispatchResponse Pause();
     DispatchResponse RemoveBreakpoint(const RemoveBreakpointParams &params);
     DispatchResponse RemoveBreakpointsByUrl(const RemoveBreakpointsByUrlParams &params);
@@ -105,7 +118,8 @@ public:
     DispatchResponse SmartStepInto(const SmartStepIntoParams &params);
     DispatchResponse StepOut();
     DispatchResponse StepOver(const StepOverParams &params);
-    DispatchResponse SetBlackboxPatterns();
+    DispatchResponse SetBlackboxPatterns(const SetBlackboxPatternsParams &params);
+    DispatchResponse SetBlackboxedRanges(const SetBlackboxedRangesParams &params);
     DispatchResponse SetMixedDebugEnabled(const SetMixedDebugParams &params);
     DispatchResponse ReplyNativeCalling(const ReplyNativeCallingParams &params);
     DispatchResponse DropFrame(const DropFrameParams &params);
@@ -116,6 +130,9 @@ public:
     DispatchResponse SaveAllPossibleBreakpoints(const SaveAllPossibleBreakpointsParams &params);
     DispatchResponse SetSymbolicBreakpoints(const SetSymbolicBreakpointsParams &params);
     DispatchResponse RemoveSymbolicBreakpoints(const RemoveSymbolicBreakpointsParams &params);
+    DispatchResponse SetPausedCallFramesLimit(const SetPausedCallFramesLimitParams &params);
+    DispatchResponse GetCallFrames(const GetCallFramesParams &params,
+                                   std::vector<std::unique_ptr<CallFrame>> *callFrames, bool *hasMore);
 
     /**
      * @brief: match first script and callback
@@ -125,43 +142,44 @@ public:
     template<class Callback>
     bool MatchScripts(const Callback &cb, const std::string &matchStr, ScriptMatchType type) const
     {
-        for (const auto &script : scripts_) {
-            std::string value;
-            switch (type) {
-                case ScriptMatchType::URL: {
-                    value = script.second->GetUrl();
-                    break;
-                }
-                case ScriptMatchType::FILE_NAME: {
-                    value = script.second->GetFileName();
-                    break;
+        switch (type) {
+            case ScriptMatchType::URL: {
+                auto iter = urlScripts_.find(matchStr);
+                if (iter == urlScripts_.end()) {
+                    return false;
                 }
-                case ScriptMatchType::HASH: {
-                    value = script.second->GetHash();
-                    break;
+                return cb(iter->second.front());
+            }
+            case ScriptMatchType::FILE_NAME: {
+                auto iter = fileNameScripts_.find(matchStr);
+                if (iter == fileNameScripts_.end()) {
+                    return false;
                 }
-                default: {
+                return cb(iter->second.front());
+            }
+            case ScriptMatchType::HASH: {
+                auto iter = hashScripts_.find(matchStr);
+                if (iter == hashScripts_.end()) {
                     return false;
                 }
+                return cb(iter->second);
             }
-            if (matchStr == value) {
-                return cb(script.second.get());
+            default: {
+                return false;
             }
         }
-        return false;
     }
 
     std::vector<PtScript *> MatchAllScripts(const std::string &url) const
     {
-        std::vector<PtScript *> result;
-        for (const auto &script : scripts_) {
-            if (url == script.second->GetUrl()) {
-                result.push_back(script.second.get());
-            }
+        auto iter = urlScripts_.find(url);
+        if (iter == urlScripts_.end()) {
+            return {};
         }
-        return result;
+        return iter->second;
     }
-    bool GenerateCallFrames(std::vector<std::unique_ptr<CallFrame>> *callFrames, bool getScope);
+    bool GenerateCallFrames(std::vector<std::unique_ptr<CallFrame>> *callFrames, bool getScope,
+                            uint32_t maxCount = 0);
     bool GenerateCallFrame(CallFrame *callFrame, const FrameHandler *frameHandler, CallFrameId frameId, bool getScope);
     bool GenerateHybridFrames(std::vector<std::unique_ptr<CallFrame>> *callFrames);
     void ProcessStaticFrame(const void *frame, CallFrameId &callFrameId,
@@ -190,6 +208,8 @@ public:
             std::unique_ptr<PtBaseReturns> &result);
         DispatchResponse GetScriptSource(const DispatchRequest &request,
             std::unique_ptr<PtBaseReturns> &result);
+        DispatchResponse GetStackTrace(const DispatchRequest &request,
+            std::unique_ptr<PtBaseReturns> &result);
         DispatchResponse Pause(const DispatchRequest &request);
         DispatchResponse RemoveBreakpoint(const DispatchRequest &request);
         DispatchResponse RemoveBreakpointsByUrl(const DispatchRequest &request);
@@ -208,6 +228,7 @@ public:
         DispatchResponse StepOver(const DispatchRequest &request);
         DispatchResponse SetMixedDebugEnabled(const DispatchRequest &request);
         DispatchResponse SetBlackboxPatterns(const DispatchRequest &request);
+        DispatchResponse SetBlackboxedRanges(const DispatchRequest &request);
         DispatchResponse ReplyNativeCalling(const DispatchRequest &request);
         DispatchResponse GetPossibleAndSetBreakpointByUrl(const DispatchRequest &request,
             std::unique_ptr<PtBaseReturns> &result);
@@ -218,6 +239,8 @@ public:
         DispatchResponse SaveAllPossibleBreakpoints(const DispatchRequest &request);
         DispatchResponse SetSymbolicBreakpoints(const DispatchRequest &request);
         DispatchResponse RemoveSymbolicBreakpoints(const DispatchRequest &request);
+        DispatchResponse SetPausedCallFramesLimit(const DispatchRequest &request);
+        DispatchResponse GetCallFrames(const DispatchRequest &request, std::unique_ptr<PtBaseReturns> &result);
 
         enum class Method {
             CONTINUE_TO_LOCATION,
@@ -226,6 +249,7 @@ public:
             EVALUATE_ON_CALL_FRAME,
             GET_POSSIBLE_BREAKPOINTS,
             GET_SCRIPT_SOURCE,
+            GET_STACK_TRACE,
             PAUSE,
             REMOVE_BREAKPOINT,
             REMOVE_BREAKPOINTS_BY_URL,
@@ -241,6 +265,7 @@ public:
             STEP_OVER,
             SET_MIXED_DEBUG_ENABLED,
             SET_BLACKBOX_PATTERNS,
+            SET_BLACKBOXED_RANGES,
             REPLY_NATIVE_CALLING,
             GET_POSSIBLE_AND_SET_BREAKPOINT_BY_URL,
             DROP_FRAME,
@@ -251,6 +276,8 @@ public:
             SAVE_ALL_POSSIBLE_BREAKPOINTS,
             SET_SYMBOLIC_BREAKPOINTS,
             REMOVE_SYMBOLIC_BREAKPOINTS,
+            SET_PAUSED_CALL_FRAMES_LIMIT,
+            GET_CALL_FRAMES,
             UNKNOWN
         };
         Method GetMethodEnum(const std::string& method);
@@ -279,7 +306,15 @@ private:
         std::unique_ptr<RemoteObject> *thisObj);
     void GetLocalVariables(const FrameHandler *frameHandler, panda_file::File::EntityId methodId,
         const JSPandaFile *jsPandaFile, Local<JSValueRef> &thisVal, Local<ObjectRef> &localObj);
+    Local<JSValueRef> GetLocalThis(const FrameHandler *frameHandler, panda_file::File::EntityId methodId,
+        const JSPandaFile *jsPandaFile);
+    bool GetClosureVariables(const JSHandle<JSTaggedValue> &envHandle, Local<ObjectRef> *closureScopeObj,
+        bool *thisFound, std::unique_ptr<RemoteObject> *thisObj);
+    void AddLazyScope(RemoteObjectId objectId, const FrameHandler *frameHandler, const std::string &type,
+        uint32_t envDepth = 0, bool skipThis = false);
+    void MaterializeScope(RemoteObjectId objectId);
     void CleanUpOnPaused();
+    void CleanUpOnResumed();
     void CleanUpRuntimeProperties();
     void UpdateScopeObject(const FrameHandler *frameHandler, std::string_view varName,
         Local<JSValueRef> newVal, const std::string& scope);
@@ -287,22 +322,55 @@ private:
     Local<JSValueRef> ConvertToLocal(const std::string &varValue);
     bool DecodeAndCheckBase64(const std::string &src, std::vector<uint8_t> &dest);
     bool IsSkipLine(const JSPtLocation &location);
+    bool IsBlackboxed(const JSPtLocation &location);
+    bool StepOutOfBlackboxedMethod(const JSPtLocation &location);
+    bool IsMethodInBlackboxedRange(const JSPtLocation &location,
+        const std::vector<std::pair<int32_t, int32_t>> &ranges);
+    struct MethodBlackbox {
+        // the whole method, its script matches the blackbox patterns or it lies inside a blackboxed range
+        bool blackboxed {false};
+        // the script of the method when it has blackboxed ranges, looked up by position
+        PtScript *rangesScript {nullptr};
+    };
+    const MethodBlackbox &GetMethodBlackbox(const JSPtLocation &location);
+    static bool ParseBlackboxPattern(const std::string &pattern, std::vector<std::string> *alternatives);
+    static bool MatchBlackboxAlternative(const std::string &alternative, size_t patternPos,
+        const std::string &url, size_t urlPos);
+    static bool MatchBlackboxAtom(const std::string &alternative, size_t patternPos, char c);
+    static bool MatchBlackboxPatterns(const std::vector<std::string> &alternatives, const std::string &url);
+    PtScript *FindMethodScript(const JSPtLocation &location);
     bool CheckPauseOnException();
     bool IsWithinVariableScope(const LocalVariableInfo &localVariableInfo, uint32_t bcOffset);
-    bool ProcessSingleBreakpoint(const BreakpointInfo &breakpoint,
-        std::vector<std::shared_ptr<BreakpointReturnInfo>> &outLocations);
+    bool ProcessSingleBreakpoint(const BreakpointInfo &breakpoint, const std::vector<DebugInfoExtractor *> &extractors,
+        std::vector<std::shared_ptr<BreakpointReturnInfo>> &outLocations, const JSPandaFile *jsPandaFile = nullptr);
+    bool SetBreakpointLocations(DebugInfoExtractor *extractor, const JSPandaFile *jsPandaFile,
+        const std::string &url, int32_t lineNumber, int32_t columnNumber, Local<FunctionRef> funcRef);
     bool IsVariableSkipped(const std::string &varName);
     Local<FunctionRef> CheckAndGenerateCondFunc(const std::optional<std::string> &condition);
+    Local<FunctionRef> GetCompiledFunc(const std::vector<uint8_t> &buffer, Local<JSValueRef> context);
+    void ClearCompiledExpressions();
+    std::string FormatLogMessage(const std::string &logMessage);
     void InitializeExtendedProtocolsList();
-    bool NeedToSetBreakpointsWhenParsingScript(const std::string &url);
-    std::vector<std::shared_ptr<BreakpointReturnInfo>> SetBreakpointsWhenParsingScript(const std::string &url);
+    bool NeedToSetBreakpointsWhenParsingScript(const std::string &url) const;
+    std::vector<std::shared_ptr<BreakpointReturnInfo>> SetBreakpointsWhenParsingScript(const std::string &url,
+        const std::string &fileName, DebugInfoExtractor *extractor);
     void SavePendingBreakpoints(const SaveAllPossibleBreakpointsParams &params);
     bool InsertIntoPendingBreakpoints(const BreakpointInfo &breakpoint);
     void SaveParsedScriptsAndUrl(const std::string &fileName, const std::string &url,
-        const std::string &recordName, const std::string &source = "");
+        const std::string &recordName, DebugInfoExtractor *extractor = nullptr,
+        panda_file::File::EntityId methodId = panda_file::File::EntityId(), int32_t endLine = 0);
+    static PtScript::SourceLoader GetSourceLoader(panda_file::File::EntityId methodId);
+    ScriptDebugInfo GetScriptDebugInfo(const JSPandaFile *jsPandaFile, DebugInfoExtractor *extractor,
+        panda_file::File::EntityId methodId);
+    FileDebugInfo *GetFileDebugInfo(const DebugInfoFileKey &key);
+    static FileDebugInfo::EndLines ScanEndLines(const JSPandaFile *jsPandaFile, DebugInfoExtractor *extractor);
+    void AddScript(const std::shared_ptr<PtScript> &script);
     void EnableDebuggerFeatures(const EnableParams &params);
     DebuggerFeature GetDebuggerFeatureEnum(std::string &option);
     void EnableFeature(DebuggerFeature feature);
+    std::string InternAsyncStack(const std::shared_ptr<AsyncStack> &asyncStack, int32_t depth);
+    void SweepInternedAsyncStacks();
+    std::unique_ptr<StackTrace> GenerateStackTrace(const std::shared_ptr<AsyncStack> &asyncStack, int32_t depth);
 
     const std::unordered_set<std::string> &GetRecordName(const std::string &url)
     {
@@ -337,13 +405,19 @@ private:
         void Resumed(const EcmaVM *vm);
         void NativeCalling(const EcmaVM *vm, const tooling::NativeCalling &nativeCalling);
         void MixedStack(const EcmaVM *vm, const tooling::MixedStack &mixedStack);
+        void ConsoleAPICalled(const EcmaVM *vm, const tooling::ConsoleAPICalled &consoleAPICalled);
         void ScriptFailedToParse(const EcmaVM *vm);
         void ScriptParsed(const EcmaVM *vm, const PtScript &script);
+        void ScriptsParsed(const EcmaVM *vm, const std::unordered_map<ScriptId, std::shared_ptr<PtScript>> &scripts);
         void WaitForDebugger(const EcmaVM *vm);
         void RunIfWaitingForDebugger(const EcmaVM *vm);
 
     private:
         bool AllowNotify(const EcmaVM *vm) const;
+        static std::unique_ptr<tooling::ScriptParsed> CreateScriptParsed(const PtScript &script);
+
+        // 1000: scripts per Debugger.scriptsParsed
+        static constexpr size_t MAX_SCRIPTS_PARSED_CHUNK = 1000;
 
         ProtocolChannel *channel_ {nullptr};
     };
@@ -359,6 +433,25 @@ private:
     std::unordered_set<std::string> recordNameSet_ {};
     std::unordered_map<std::string, std::unordered_set<std::string>> urlFileNameMap_ {};
     std::unordered_map<ScriptId, std::shared_ptr<PtScript>> scripts_ {};
+    // Indexes of scripts_ for MatchScripts, the scripts of the same key are in the order of parsing
+    std::unordered_map<std::string, std::vector<PtScript *>> urlScripts_ {};
+    std::unordered_map<std::string, std::vector<PtScript *>> fileNameScripts_ {};
+    std::unordered_map<std::string, PtScript *> hashScripts_ {};
+    // The scripts load their sources from the debug info of their files on Debugger.getScriptSource,
+    // and the sources requested last are kept up to maxScriptsCacheSize bytes of Debugger.enable
+    PtScriptSourceCache scriptSourceCache_ {};
+    // The end lines of the files the scripts were parsed from, shared with the debuggers of the
+    // other VMs of the process which load the same files, and released with the debugger
+    std::map<DebugInfoFileKey, std::shared_ptr<FileDebugInfo>> fileDebugInfos_ {};
+    // The locations the pending breakpoints resolved to on former launches, read from breakpointsCachePath
+    // of Debugger.enable
+    PtBreakpointCache breakpointsCache_ {};
+    // The patterns of Debugger.setBlackboxPatterns split into their alternatives. They are matched
+    // against the url of a script once, when it is parsed or the patterns change, and stepping only
+    // reads the flag of the method, resolved once from the script it belongs to
+    std::vector<std::string> blackboxPatterns_ {};
+    bool hasBlackboxedRanges_ {false};
+    std::map<std::pair<const JSPandaFile *, uint32_t>, MethodBlackbox> methodBlackboxes_ {};
     PauseOnExceptionsState pauseOnException_ {PauseOnExceptionsState::NONE};
     DebuggerState debuggerState_ {DebuggerState::ENABLED};
     bool pauseOnNextByteCode_ {false};
@@ -366,6 +459,8 @@ private:
     bool skipAllPausess_ {false};
     bool mixStackEnabled_ {false};
     int32_t maxAsyncCallChainDepth_ {0};
+    // 0: Debugger.paused carries all the call frames
+    uint32_t pausedCallFramesLimit_ {0};
     std::unique_ptr<SingleStepper> singleStepper_ {nullptr};
     Location location_ {};
 
@@ -373,18 +468,87 @@ private:
     std::vector<void *>  nativePointer_;
 
     bool nativeOutPause_ {false};
+    // The native ranges of Debugger.setNativeRange, sorted by start with the overlapping and
+    // adjacent ones merged, so IsUserCode is a binary search
+    static std::vector<NativeRange> MergeNativeRanges(std::vector<NativeRange> nativeRanges);
     std::vector<NativeRange> nativeRanges_ {};
     std::unordered_map<JSTaggedType *, std::unordered_map<std::string,
         std::vector<RemoteObjectId>>> scopeObjects_ {};
+    // The scope objects of the paused frames are created empty, and their variables are filled in
+    // by MaterializeScope when they are first inspected
+    struct LazyScope {
+        std::shared_ptr<FrameHandler> frameHandler {nullptr};
+        std::string type {};
+        // depth of the lexical env of a closure scope in the env chain of the frame
+        uint32_t envDepth {0};
+        // 'this' in the lexical env has been taken as the 'this' of the frame
+        bool skipThis {false};
+    };
+    std::unordered_map<RemoteObjectId, LazyScope> lazyScopes_ {};
+    bool lazyScopeChain_ {false};
     std::vector<std::shared_ptr<FrameHandler>> callFrameHandlers_;
     JsDebuggerManager::ObjectUpdaterFunc updaterFunc_ {nullptr};
     JsDebuggerManager::SingleStepperFunc stepperFunc_ {nullptr};
     JsDebuggerManager::ReturnNativeFunc returnNative_ {nullptr};
     std::vector<std::string> debuggerExtendedProtocols_ {};
-    // For launch accelerate mode
+    // For launch accelerate mode, the breakpoints to set when a script of the url is parsed
     std::unordered_map<std::string, CUnorderedSet<std::shared_ptr<BreakpointInfo>, HashBreakpointInfo>>
         breakpointPendingMap_ {};
     bool breakOnStartEnable_ {true};
+    // Logpoints and hit conditions of the breakpoints set by url, checked by NotifyBreakpointHit
+    // before a breakpoint pauses
+    enum class HitConditionType : uint8_t { NONE, EVERY, AFTER };
+    struct BreakpointAction {
+        std::string url {};
+        std::optional<std::string> logMessage {};
+        HitConditionType hitConditionType {HitConditionType::NONE};
+        uint32_t hitConditionCount {0};
+        uint32_t hitCount {0};
+    };
+    using BreakpointActionKey = std::tuple<const JSPandaFile *, uint32_t, uint32_t>;
+    static BreakpointActionKey GetBreakpointActionKey(const JSPtLocation &location)
+    {
+        return {location.GetJsPandaFile(), location.GetMethodId().GetOffset(), location.GetBytecodeOffset()};
+    }
+    bool ParseHitCondition(const std::string &hitCondition, BreakpointAction *action);
+    std::map<BreakpointActionKey, BreakpointAction> breakpointActions_ {};
+    // The extended filters of Debugger.setPauseOnExceptions, checked by NotifyException before an
+    // exception pause builds its call frames. The url patterns are split into their alternatives as
+    // the blackbox patterns, and the throws are counted by the bytecode of the throwing site
+    bool CheckExceptionFilters(const JSPtLocation &location, Local<JSValueRef> exception);
+    bool MatchExceptionErrorName(Local<JSValueRef> exception) const;
+    bool MatchExceptionUrl(const std::string &url) const;
+    bool SampleExceptionSite(const JSPtLocation &location);
+    std::unordered_set<std::string> exceptionErrorNames_ {};
+    std::vector<std::string> exceptionUrlPatterns_ {};
+    // 1: pauses on every throw of a site
+    uint32_t exceptionThrowsPerPause_ {1};
+    std::map<BreakpointActionKey, uint32_t> exceptionSiteThrows_ {};
+    // The functions compiled from the bytecode of conditions, evaluateOnCallFrame expressions and
+    // callFunctionOn declarations, keyed by the bytecode and checked against the global env they were
+    // compiled in
+    struct CompiledExpression {
+        Global<JSValueRef> context;
+        Global<FunctionRef> func;
+    };
+    std::unordered_map<std::string, CompiledExpression> compiledExpressions_ {};
+    // 64: compiled expressions kept before the cache is cleared
+    static constexpr size_t MAX_COMPILED_EXPRESSIONS = 64;
+    // With enableAsyncStackTraceId, Debugger.paused carries only the top segment of the async stack and
+    // the frontend fetches the parents by id with getStackTrace. The ids are interned per async stack, so
+    // a parent shared by many pauses is sent once, and the depth of a segment counts from the pause
+    struct InternedAsyncStack {
+        std::weak_ptr<AsyncStack> asyncStack {};
+        int32_t depth {0};
+    };
+    bool asyncStackTraceId_ {false};
+    // The scripts already parsed are sent in Debugger.scriptsParsed chunks by Debugger.enable
+    bool batchScriptParsed_ {false};
+    uint32_t curAsyncStackId_ {0};
+    std::unordered_map<std::string, InternedAsyncStack> internedAsyncStacks_ {};
+    std::unordered_map<const AsyncStack *, std::string> asyncStackIds_ {};
+    // 1024: interned async stacks kept before the released ones are swept
+    static constexpr size_t MAX_INTERNED_ASYNC_STACKS = 1024;
 
     friend class JSPtHooks;
     friend class test::TestHooks;
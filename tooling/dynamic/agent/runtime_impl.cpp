@@ -15,6 +15,8 @@
 
 #include "agent/runtime_impl.h"
 
+#include <algorithm>
+
 #include "protocol_channel.h"
 
 namespace panda::ecmascript::tooling {
@@ -49,6 +51,12 @@ std::optional<std::string> RuntimeImpl::DispatcherImpl::Dispatch(const DispatchR
         case Method::GET_HEAP_USAGE:
             response = GetHeapUsage(request, result);
             break;
+        case Method::RELEASE_OBJECT:
+            response = ReleaseObject(request);
+            break;
+        case Method::RELEASE_OBJECT_GROUP:
+            response = ReleaseObjectGroup(request);
+            break;
         default:
             response = DispatchResponse::Fail("unknown method: " + request.GetMethod());
             break;
@@ -77,6 +85,10 @@ RuntimeImpl::DispatcherImpl::Method RuntimeImpl::DispatcherImpl::GetMethodEnum(c
         return Method::RUN_IF_WAITING_FOR_DEBUGGER;
     } else if (method == "getHeapUsage") {
         return Method::GET_HEAP_USAGE;
+    } else if (method == "releaseObject") {
+        return Method::RELEASE_OBJECT;
+    } else if (method == "releaseObjectGroup") {
+        return Method::RELEASE_OBJECT_GROUP;
     } else {
         return Method::UNKNOWN;
     }
@@ -115,8 +127,9 @@ DispatchResponse RuntimeImpl::DispatcherImpl::GetProperties(const DispatchReques
     std::optional<std::vector<std::unique_ptr<InternalPropertyDescriptor>>> outInternalDescs;
     std::optional<std::vector<std::unique_ptr<PrivatePropertyDescriptor>>> outPrivateProperties;
     std::optional<std::unique_ptr<ExceptionDetails>> outExceptionDetails;
+    std::optional<bool> outHasMore;
     DispatchResponse response = runtime_->GetProperties(*params, &outPropertyDesc, &outInternalDescs,
-        &outPrivateProperties, &outExceptionDetails);
+        &outPrivateProperties, &outExceptionDetails, &outHasMore);
     if (outExceptionDetails) {
         ASSERT(outExceptionDetails.value() != nullptr);
         LOG_DEBUGGER(WARN) << "GetProperties thrown an exception";
@@ -124,7 +137,8 @@ DispatchResponse RuntimeImpl::DispatcherImpl::GetProperties(const DispatchReques
     result = std::make_unique<GetPropertiesReturns>(std::move(outPropertyDesc),
         std::move(outInternalDescs),
         std::move(outPrivateProperties),
-        std::move(outExceptionDetails));
+        std::move(outExceptionDetails),
+        outHasMore);
     return response;
 }
 
@@ -138,6 +152,26 @@ DispatchResponse RuntimeImpl::DispatcherImpl::GetHeapUsage(const DispatchRequest
     return response;
 }
 
+DispatchResponse RuntimeImpl::DispatcherImpl::ReleaseObject(const DispatchRequest &request)
+{
+    std::unique_ptr<ReleaseObjectParams> params = ReleaseObjectParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    DispatchResponse response = runtime_->ReleaseObject(*params);
+    return response;
+}
+
+DispatchResponse RuntimeImpl::DispatcherImpl::ReleaseObjectGroup(const DispatchRequest &request)
+{
+    std::unique_ptr<ReleaseObjectGroupParams> params = ReleaseObjectGroupParams::Create(request.GetParams());
+    if (params == nullptr) {
+        return DispatchResponse::Fail("wrong params");
+    }
+    DispatchResponse response = runtime_->ReleaseObjectGroup(*params);
+    return response;
+}
+
 bool RuntimeImpl::Frontend::AllowNotify() const
 {
     return channel_ != nullptr;
@@ -182,15 +216,105 @@ DispatchResponse RuntimeImpl::GetHeapUsage(double *usedSize, double *totalSize)
     return DispatchResponse::Ok();
 }
 
+DispatchResponse RuntimeImpl::ReleaseObject(const ReleaseObjectParams &params)
+{
+    FreeObject(params.GetObjectId());
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse RuntimeImpl::ReleaseObjectGroup(const ReleaseObjectGroupParams &params)
+{
+    FreeObjectGroup(params.GetObjectGroup());
+    return DispatchResponse::Ok();
+}
+
+void RuntimeImpl::AddObjectGroup(const std::string &objectGroup, RemoteObjectId firstId)
+{
+    for (RemoteObjectId objectId = firstId; objectId < curObjectId_; objectId++) {
+        if (properties_.find(objectId) == properties_.end()) {
+            continue;
+        }
+        if (objectGroupNames_.emplace(objectId, objectGroup).second) {
+            objectGroups_[objectGroup].push_back(objectId);
+        }
+    }
+}
+
+void RuntimeImpl::FreeObject(RemoteObjectId objectId)
+{
+    auto iter = properties_.find(objectId);
+    if (iter == properties_.end()) {
+        return;
+    }
+    iter->second.FreeGlobalHandleAddr();
+    properties_.erase(iter);
+    objectGroupNames_.erase(objectId);
+    auto namesIter = propertyNames_.find(objectId);
+    if (namesIter != propertyNames_.end()) {
+        namesIter->second.FreeGlobalHandleAddr();
+        propertyNames_.erase(namesIter);
+    }
+}
+
+void RuntimeImpl::FreeObjectGroup(const std::string &objectGroup)
+{
+    auto iter = objectGroups_.find(objectGroup);
+    if (iter == objectGroups_.end()) {
+        return;
+    }
+    // the objects released on their own are already gone and skipped
+    for (RemoteObjectId objectId : iter->second) {
+        FreeObject(objectId);
+    }
+    objectGroups_.erase(iter);
+}
+
+void RuntimeImpl::FreeAllObjects()
+{
+    for (auto &property : properties_) {
+        property.second.FreeGlobalHandleAddr();
+    }
+    for (auto &names : propertyNames_) {
+        names.second.FreeGlobalHandleAddr();
+    }
+    curObjectId_ = 0;
+    properties_.clear();
+    objectGroupNames_.clear();
+    objectGroups_.clear();
+    propertyNames_.clear();
+}
+
 DispatchResponse RuntimeImpl::GetProperties(const GetPropertiesParams &params,
     std::vector<std::unique_ptr<PropertyDescriptor>> *outPropertyDesc,
     [[maybe_unused]] std::optional<std::vector<std::unique_ptr<InternalPropertyDescriptor>>> *outInternalDescs,
     [[maybe_unused]] std::optional<std::vector<std::unique_ptr<PrivatePropertyDescriptor>>> *outPrivateProps,
-    [[maybe_unused]] std::optional<std::unique_ptr<ExceptionDetails>> *outExceptionDetails)
+    [[maybe_unused]] std::optional<std::unique_ptr<ExceptionDetails>> *outExceptionDetails,
+    std::optional<bool> *outHasMore)
+{
+    RemoteObjectId firstId = curObjectId_;
+    hasMoreProperties_ = false;
+    DispatchResponse response = GetObjectProperties(params, outPropertyDesc);
+    if (outHasMore != nullptr && params.IsValidRequestUsingRange()) {
+        *outHasMore = hasMoreProperties_;
+    }
+    // the objects of the properties are released together with the object they are read from
+    auto iter = objectGroupNames_.find(params.GetObjectId());
+    if (iter != objectGroupNames_.end()) {
+        std::string objectGroup = iter->second;
+        AddObjectGroup(objectGroup, firstId);
+    }
+    return response;
+}
+
+DispatchResponse RuntimeImpl::GetObjectProperties(const GetPropertiesParams &params,
+    std::vector<std::unique_ptr<PropertyDescriptor>> *outPropertyDesc)
 {
     RemoteObjectId objectId = params.GetObjectId();
     bool isOwn = params.GetOwnProperties();
     bool isAccessorOnly = params.GetAccessPropertiesOnly();
+    if (lazyObjectLoader_ != nullptr) {
+        lazyObjectLoader_(objectId);
+    }
     auto iter = properties_.find(objectId);
     if (iter == properties_.end()) {
         LOG_DEBUGGER(ERROR) << "RuntimeImpl::GetProperties Unknown object id: " << objectId;
@@ -310,12 +434,37 @@ DispatchResponse RuntimeImpl::GetProperties(const GetPropertiesParams &params,
         return DispatchResponse::Ok();
     }
     int32_t start = 0;
-    Local<ArrayRef> keys = Local<ObjectRef>(value)->GetOwnPropertyNames(vm_);
-    int32_t end = static_cast<int32_t>(keys->Length(vm_));
-    AdjustStartAndLength(params, start, end);
+    int32_t end = 0;
+    int32_t arrayLength = 0;
+    Local<ArrayRef> keys;
+    // an array paged by range reads the elements of the page by index instead of listing all of its keys,
+    // the indices are followed by its named own properties, 'length' first, as in its own property names
+    bool pageByIndex = params.IsValidRequestUsingRange() && value->IsArray(vm_);
+    if (pageByIndex) {
+        arrayLength = static_cast<int32_t>(Local<ArrayRef>(value)->Length(vm_));
+        // 1: 'length', always after the indices, the other named properties are listed once a page reaches them
+        end = arrayLength + 1;
+        if (static_cast<int64_t>(params.GetStartIndex()) + params.GetGroupCount() > arrayLength) {
+            keys = GetOwnNamedPropertyNames(params, Local<ObjectRef>(value), arrayLength);
+            end = arrayLength + static_cast<int32_t>(keys->Length(vm_));
+        }
+    } else {
+        keys = GetOwnPropertyNames(params, Local<ObjectRef>(value));
+        end = static_cast<int32_t>(keys->Length(vm_));
+    }
+    if (params.IsValidRequestUsingRange() && params.GetStartIndex() >= end) {
+        // the page after the last one of the own properties is empty, listing all of them could take long
+        start = end;
+    } else {
+        AdjustStartAndLength(params, start, end);
+    }
     Local<JSValueRef> name = JSValueRef::Undefined(vm_);
     for (int32_t i = start; i < end; ++i) {
-        name = keys->Get(vm_, i);
+        if (pageByIndex) {
+            name = i < arrayLength ? Local<JSValueRef>(NumberRef::New(vm_, i)) : keys->Get(vm_, i - arrayLength);
+        } else {
+            name = keys->Get(vm_, i);
+        }
         PropertyAttribute jsProperty = PropertyAttribute::Default();
         if (!Local<ObjectRef>(value)->GetOwnProperty(vm_, name, jsProperty)) {
             continue;
@@ -362,7 +511,7 @@ void RuntimeImpl::AdjustStartAndLength(const GetPropertiesParams &params, int32_
     }
     int32_t startIndex = params.GetStartIndex();
     int32_t groupCount = params.GetGroupCount();
-    // invalid startIndex if startIndex >= length
+    // invalid startIndex if startIndex >= length, the whole of the object is listed
     if (startIndex >= end) {
         LOG_DEBUGGER(DEBUG) << "RuntimeImpl::AdjustStartAndLength Invalid 'start' from request, "
             << "start = " << startIndex << ", but end = " << end;
@@ -372,10 +521,84 @@ void RuntimeImpl::AdjustStartAndLength(const GetPropertiesParams &params, int32_
     start = startIndex;
     // if start + count < length, the right margin will just be start + count,
     // else it will just be length
-    end = (start + groupCount <= end) ? (start + groupCount) : end;
+    hasMoreProperties_ = groupCount < end - start;
+    end = hasMoreProperties_ ? (start + groupCount) : end;
     LOG_DEBUGGER(INFO) << "RuntimeImpl::AdjustStartAndLength after adjustment, start = " << start << ", end = " << end;
 }
 
+Local<ArrayRef> RuntimeImpl::GetOwnPropertyNames(const GetPropertiesParams &params, Local<ObjectRef> object)
+{
+    if (!params.IsValidRequestUsingRange()) {
+        return object->GetOwnPropertyNames(vm_);
+    }
+    // the first page lists the names again, so that expanding the object anew sees its current keys
+    RemoteObjectId objectId = params.GetObjectId();
+    auto iter = propertyNames_.find(objectId);
+    if (iter != propertyNames_.end()) {
+        if (params.GetStartIndex() != 0) {
+            return Local<ArrayRef>(vm_, iter->second);
+        }
+        iter->second.FreeGlobalHandleAddr();
+        propertyNames_.erase(iter);
+    }
+    Local<ArrayRef> keys = object->GetOwnPropertyNames(vm_);
+    propertyNames_.emplace(objectId, Global<ArrayRef>(vm_, keys));
+    return keys;
+}
+
+Local<ArrayRef> RuntimeImpl::GetOwnNamedPropertyNames(const GetPropertiesParams &params, Local<ObjectRef> object,
+    int32_t arrayLength)
+{
+    // the first page reaching the named properties lists them again, the following ones reuse them
+    RemoteObjectId objectId = params.GetObjectId();
+    auto iter = propertyNames_.find(objectId);
+    if (iter != propertyNames_.end()) {
+        if (params.GetStartIndex() > arrayLength) {
+            return Local<ArrayRef>(vm_, iter->second);
+        }
+        iter->second.FreeGlobalHandleAddr();
+        propertyNames_.erase(iter);
+    }
+    // the own property names list the indices first, in ascending order, the named ones follow
+    Local<ArrayRef> keys = object->GetOwnPropertyNames(vm_);
+    uint32_t low = 0;
+    uint32_t high = keys->Length(vm_);
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;  // 2: halve the range
+        if (IsArrayIndex(keys->Get(vm_, mid))) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    uint32_t namedCount = keys->Length(vm_) - low;
+    Local<ArrayRef> namedKeys = ArrayRef::New(vm_, namedCount);
+    for (uint32_t i = 0; i < namedCount; i++) {
+        ArrayRef::SetValueAt(vm_, namedKeys, i, keys->Get(vm_, low + i));
+    }
+    propertyNames_.emplace(objectId, Global<ArrayRef>(vm_, namedKeys));
+    return namedKeys;
+}
+
+bool RuntimeImpl::IsArrayIndex(Local<JSValueRef> key)
+{
+    if (key->IsNumber()) {
+        return true;
+    }
+    if (!key->IsString(vm_)) {
+        return false;
+    }
+    // the canonical decimal form of an integer below 2^32 - 1
+    std::string str = Local<StringRef>(key)->ToString(vm_);
+    constexpr size_t maxIndexDigits = 10;  // 10: digits of 4294967294
+    if (str.empty() || str.size() > maxIndexDigits || (str.size() > 1 && str[0] == '0') ||
+        !std::all_of(str.begin(), str.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return false;
+    }
+    constexpr uint64_t maxArrayIndex = 4294967294;  // 4294967294: 2^32 - 2, the largest array index
+    return std::stoull(str) <= maxArrayIndex;
+}
+
 void RuntimeImpl::AddTypedArrayRefs(Local<ArrayBufferRef> arrayBufferRef,
     std::vector<std::unique_ptr<PropertyDescriptor>> *outPropertyDesc)
 {
@@ -38,7 +38,15 @@ public:
         std::vector<std::unique_ptr<PropertyDescriptor>> *outPropertyDesc,
         std::optional<std::vector<std::unique_ptr<InternalPropertyDescriptor>>> *outInternalDescs,
         std::optional<std::vector<std::unique_ptr<PrivatePropertyDescriptor>>> *outPrivateProps,
-        std::optional<std::unique_ptr<ExceptionDetails>> *outExceptionDetails);
+        std::optional<std::unique_ptr<ExceptionDetails>> *outExceptionDetails,
+        std::optional<bool> *outHasMore = nullptr);
+    DispatchResponse ReleaseObject(const ReleaseObjectParams &params);
+    DispatchResponse ReleaseObjectGroup(const ReleaseObjectGroupParams &params);
+    // the remote objects handed out and not released yet
+    size_t GetRetainedObjectCount() const
+    {
+        return properties_.size();
+    }
 
     class DispatcherImpl final : public DispatcherBase {
     public:
@@ -52,6 +60,8 @@ public:
         DispatchResponse RunIfWaitingForDebugger(const DispatchRequest &request);
         DispatchResponse GetProperties(const DispatchRequest &request, std::unique_ptr<PtBaseReturns> &result);
         DispatchResponse GetHeapUsage(const DispatchRequest &request, std::unique_ptr<PtBaseReturns> &result);
+        DispatchResponse ReleaseObject(const DispatchRequest &request);
+        DispatchResponse ReleaseObjectGroup(const DispatchRequest &request);
 
         enum class Method {
             ENABLE,
@@ -59,6 +69,8 @@ public:
             GET_PROPERTIES,
             RUN_IF_WAITING_FOR_DEBUGGER,
             GET_HEAP_USAGE,
+            RELEASE_OBJECT,
+            RELEASE_OBJECT_GROUP,
             UNKNOWN
         };
         Method GetMethodEnum(const std::string& method);
@@ -76,6 +88,13 @@ private:
     enum NumberSize : uint8_t { BYTES_OF_16BITS = 2, BYTES_OF_32BITS = 4, BYTES_OF_64BITS = 8 };
 
     void CacheObjectIfNeeded(Local<JSValueRef> valRef, RemoteObject *remoteObj);
+    DispatchResponse GetObjectProperties(const GetPropertiesParams &params,
+        std::vector<std::unique_ptr<PropertyDescriptor>> *outPropertyDesc);
+    // the objects handed out from firstId on join the object group, unless they are in one already
+    void AddObjectGroup(const std::string &objectGroup, RemoteObjectId firstId);
+    void FreeObject(RemoteObjectId objectId);
+    void FreeObjectGroup(const std::string &objectGroup);
+    void FreeAllObjects();
 
     template <typename TypedArrayRef>
     void AddTypedArrayRef(Local<ArrayBufferRef> arrayBufferRef, int32_t length,
@@ -216,6 +235,11 @@ private:
         const GetPropertiesParams &params);
 
     void AdjustStartAndLength(const GetPropertiesParams &params, int32_t &start, int32_t &length);
+    Local<ArrayRef> GetOwnPropertyNames(const GetPropertiesParams &params, Local<ObjectRef> object);
+    // the own property names of an array after its indices
+    Local<ArrayRef> GetOwnNamedPropertyNames(const GetPropertiesParams &params, Local<ObjectRef> object,
+        int32_t arrayLength);
+    bool IsArrayIndex(Local<JSValueRef> key);
 
     std::string ModifySizeInDescription(const std::string &description, uint32_t size);
 
@@ -237,7 +261,16 @@ private:
 
     RemoteObjectId curObjectId_ {0};
     std::unordered_map<RemoteObjectId, Global<JSValueRef>> properties_ {};
+    std::unordered_map<RemoteObjectId, std::string> objectGroupNames_ {};
+    std::unordered_map<std::string, std::vector<RemoteObjectId>> objectGroups_ {};
+    // The own property names of the objects paged by 'start' and 'count', listed when the first page is
+    // read and kept for the following pages until the object is released
+    std::unordered_map<RemoteObjectId, Global<ArrayRef>> propertyNames_ {};
+    // whether the page cut by the last AdjustStartAndLength leaves properties after it
+    bool hasMoreProperties_ {false};
     Global<MapRef> internalObjects_;
+    // set by DebuggerImpl to fill the lazily created scope objects before they are inspected
+    std::function<void(RemoteObjectId)> lazyObjectLoader_ {nullptr};
     std::vector<std::string> runtimeExtendedProtocols_ {};
     static constexpr uint32_t NO_NEED_TO_ADJUST_SIZE {0};
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "agent/toolchain_impl.h"
+
+namespace panda::ecmascript::tooling {
+std::optional<std::string> ToolchainImpl::DispatcherImpl::Dispatch(const DispatchRequest &request,
+    bool crossLanguageDebug)
+{
+    Method method = GetMethodEnum(request.GetMethod());
+    LOG_DEBUGGER(DEBUG) << "dispatch [" << request.GetMethod() << "] to ToolchainImpl";
+    DispatchResponse response = DispatchResponse::Fail("Unknown method: " + request.GetMethod());
+    std::unique_ptr<PtBaseReturns> result = nullptr;
+    switch (method) {
+        case Method::ENABLE_PROTOCOL_METRICS:
+            response = EnableProtocolMetrics(request);
+            break;
+        case Method::DISABLE_PROTOCOL_METRICS:
+            response = DisableProtocolMetrics(request);
+            break;
+        case Method::RESET_PROTOCOL_METRICS:
+            response = ResetProtocolMetrics(request);
+            break;
+        case Method::GET_PROTOCOL_METRICS:
+            response = GetProtocolMetrics(request, result);
+            break;
+        default:
+            response = DispatchResponse::Fail("Unknown method: " + request.GetMethod());
+            break;
+    }
+    if (crossLanguageDebug) {
+        return ReturnsValueToString(request.GetCallId(), response, std::move(result));
+    }
+    if (result != nullptr) {
+        SendResponse(request, response, *result);
+    } else {
+        SendResponse(request, response);
+    }
+    return std::nullopt;
+}
+
+ToolchainImpl::DispatcherImpl::Method ToolchainImpl::DispatcherImpl::GetMethodEnum(const std::string& method)
+{
+    if (method == "enableProtocolMetrics") {
+        return Method::ENABLE_PROTOCOL_METRICS;
+    } else if (method == "disableProtocolMetrics") {
+        return Method::DISABLE_PROTOCOL_METRICS;
+    } else if (method == "resetProtocolMetrics") {
+        return Method::RESET_PROTOCOL_METRICS;
+    } else if (method == "getProtocolMetrics") {
+        return Method::GET_PROTOCOL_METRICS;
+    } else {
+        return Method::UNKNOWN;
+    }
+}
+
+DispatchResponse ToolchainImpl::DispatcherImpl::EnableProtocolMetrics([[maybe_unused]] const DispatchRequest &request)
+{
+    return toolchain_->EnableProtocolMetrics();
+}
+
+DispatchResponse ToolchainImpl::DispatcherImpl::DisableProtocolMetrics([[maybe_unused]] const DispatchRequest &request)
+{
+    return toolchain_->DisableProtocolMetrics();
+}
+
+DispatchResponse ToolchainImpl::DispatcherImpl::ResetProtocolMetrics([[maybe_unused]] const DispatchRequest &request)
+{
+    return toolchain_->ResetProtocolMetrics();
+}
+
+DispatchResponse ToolchainImpl::DispatcherImpl::GetProtocolMetrics([[maybe_unused]] const DispatchRequest &request,
+    std::unique_ptr<PtBaseReturns> &result)
+{
+    std::map<std::string, MethodMetrics> metrics;
+    std::map<std::string, MethodMetrics> events;
+    DispatchResponse response = toolchain_->GetProtocolMetrics(&metrics, &events);
+    result = std::make_unique<GetProtocolMetricsReturns>(std::move(metrics), std::move(events));
+    return response;
+}
+
+DispatchResponse ToolchainImpl::EnableProtocolMetrics()
+{
+    metrics_->SetEnabled(true);
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse ToolchainImpl::DisableProtocolMetrics()
+{
+    metrics_->SetEnabled(false);
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse ToolchainImpl::ResetProtocolMetrics()
+{
+    metrics_->Reset();
+    return DispatchResponse::Ok();
+}
+
+DispatchResponse ToolchainImpl::GetProtocolMetrics(std::map<std::string, MethodMetrics> *metrics,
+    std::map<std::string, MethodMetrics> *events)
+{
+    *metrics = metrics_->GetMetrics();
+    *events = metrics_->GetEventMetrics();
+    return DispatchResponse::Ok();
+}
+}  // namespace panda::ecmascript::tooling
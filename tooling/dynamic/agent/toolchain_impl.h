@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_AGENT_TOOLCHAIN_IMPL_H
+#define ECMASCRIPT_TOOLING_AGENT_TOOLCHAIN_IMPL_H
+
+#include "base/pt_metrics.h"
+#include "base/pt_params.h"
+#include "base/pt_returns.h"
+#include "dispatcher.h"
+
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript::tooling {
+// Extension domain for the toolchain itself, it is not a standard CDP domain
+class ToolchainImpl final {
+public:
+    explicit ToolchainImpl(ProtocolMetrics *metrics) : metrics_(metrics) {}
+    ~ToolchainImpl() = default;
+
+    DispatchResponse EnableProtocolMetrics();
+    DispatchResponse DisableProtocolMetrics();
+    DispatchResponse ResetProtocolMetrics();
+    DispatchResponse GetProtocolMetrics(std::map<std::string, MethodMetrics> *metrics,
+        std::map<std::string, MethodMetrics> *events);
+
+    class DispatcherImpl final : public DispatcherBase {
+    public:
+        DispatcherImpl(ProtocolChannel *channel, std::unique_ptr<ToolchainImpl> toolchain)
+            : DispatcherBase(channel), toolchain_(std::move(toolchain)) {}
+        ~DispatcherImpl() override = default;
+
+        std::optional<std::string> Dispatch(const DispatchRequest &request, bool crossLanguageDebug = false) override;
+        DispatchResponse EnableProtocolMetrics(const DispatchRequest &request);
+        DispatchResponse DisableProtocolMetrics(const DispatchRequest &request);
+        DispatchResponse ResetProtocolMetrics(const DispatchRequest &request);
+        DispatchResponse GetProtocolMetrics(const DispatchRequest &request, std::unique_ptr<PtBaseReturns> &result);
+
+        enum class Method {
+            ENABLE_PROTOCOL_METRICS,
+            DISABLE_PROTOCOL_METRICS,
+            RESET_PROTOCOL_METRICS,
+            GET_PROTOCOL_METRICS,
+            UNKNOWN
+        };
+        Method GetMethodEnum(const std::string& method);
+
+    private:
+        NO_COPY_SEMANTIC(DispatcherImpl);
+        NO_MOVE_SEMANTIC(DispatcherImpl);
+
+        std::unique_ptr<ToolchainImpl> toolchain_ {};
+    };
+
+private:
+    NO_COPY_SEMANTIC(ToolchainImpl);
+    NO_MOVE_SEMANTIC(ToolchainImpl);
+
+    ProtocolMetrics *metrics_ {nullptr};
+};
+}  // namespace panda::ecmascript::tooling
+#endif
@@ -31,50 +31,58 @@ void JSPtHooks::Breakpoint(const JSPtLocation &location)
                          << location.GetBytecodeOffset();
 
     [[maybe_unused]] LocalScope scope(debugger_->vm_);
+    // logpoints and breakpoints whose hit condition is not met do not pause
+    if (!debugger_->NotifyBreakpointHit(location)) {
+        return;
+    }
     debugger_->NotifyPaused(location, OTHER);
 }
 
-void JSPtHooks::Exception([[maybe_unused]] const JSPtLocation &location)
+void JSPtHooks::Exception(const JSPtLocation &location)
 {
     LOG_DEBUGGER(DEBUG) << "JSPtHooks: Exception";
     [[maybe_unused]] LocalScope scope(debugger_->vm_);
 
-    debugger_->NotifyPaused({}, EXCEPTION);
+    debugger_->NotifyException(location);
 }
 
 bool JSPtHooks::SingleStep(const JSPtLocation &location)
 {
-    [[maybe_unused]] LocalScope scope(debugger_->vm_);
-
     // Break_on_start event will be the very first one
     // to be verified or notified
     if (UNLIKELY(firstTime_)) {
         firstTime_ = false;
 
+        [[maybe_unused]] LocalScope scope(debugger_->vm_);
         debugger_->NotifyPaused({}, BREAK_ON_START);
         return false;
     }
 
     // pause by single step from static side
-    if (debugger_->isHybrid_ &&
-        HybridSingleStepper::GetInstance().GetHybridSingleStepFlag(HybridStepDirection::STATIC_TO_DYNAMIC)) {
+    if (UNLIKELY(debugger_->isHybrid_ &&
+        HybridSingleStepper::GetInstance().GetHybridSingleStepFlag(HybridStepDirection::STATIC_TO_DYNAMIC))) {
         LOG_DEBUGGER(DEBUG) << "JSPtHooks::SingleStep paused by single step from static side";
         // reset STATIC_TO_DYNAMIC to false to avoid redundant pauses
         HybridSingleStepper::GetInstance().SetHybridSingleStepFlag(HybridStepDirection::STATIC_TO_DYNAMIC, false);
+        [[maybe_unused]] LocalScope scope(debugger_->vm_);
         debugger_->NotifyPaused({}, OTHER);
         return true;
     }
 
-    // pause or step complete
-    if (debugger_->NotifySingleStep(location)) {
-        // pause for symbol breakpoint
-        if (breakOnSymbol_) {
-            debugger_->NotifyPaused({}, SYMBOL);
-            breakOnSymbol_ = false;
+    // pause or step complete. The handle scope is only needed while stepping, as completing a step looks up
+    // the extractor, the script and the method of the location, and the idle hook creates no handle
+    if (UNLIKELY(debugger_->IsStepping())) {
+        [[maybe_unused]] LocalScope scope(debugger_->vm_);
+        if (debugger_->NotifySingleStep(location)) {
+            // pause for symbol breakpoint
+            if (breakOnSymbol_) {
+                debugger_->NotifyPaused({}, SYMBOL);
+                breakOnSymbol_ = false;
+                return true;
+            }
+            debugger_->NotifyPaused({}, OTHER);
             return true;
         }
-        debugger_->NotifyPaused({}, OTHER);
-        return true;
     }
 
     // temporary "safepoint" to handle possible protocol command
@@ -15,50 +15,70 @@
 
 #include "backend/js_single_stepper.h"
 
+#include <algorithm>
+
 #include "ecmascript/debugger/debugger_api.h"
 #include "ecmascript/jspandafile/js_pandafile_manager.h"
 
 namespace panda::ecmascript::tooling {
-uint32_t SingleStepper::GetStackDepth() const
+JSTaggedType *SingleStepper::GetFrameSp() const
 {
-    return DebuggerApi::GetStackDepth(ecmaVm_);
+    // only the innermost js frame is visited, so this does not depend on the depth of the stack
+    JSTaggedType *sp = nullptr;
+    auto walkerFunc = [&sp](const FrameHandler *frameHandler) -> StackState {
+        if (DebuggerApi::IsNativeMethod(frameHandler)) {
+            return StackState::CONTINUE;
+        }
+        sp = DebuggerApi::GetSp(frameHandler);
+        return StackState::SUCCESS;
+    };
+    DebuggerApi::StackWalker(ecmaVm_, walkerFunc);
+    return sp;
 }
 
 bool SingleStepper::InStepRange(uint32_t pc) const
 {
-    for (const auto &range : stepRanges_) {
-        if (pc >= range.startBcOffset && pc < range.endBcOffset) {
-            return true;
-        }
+    // the ranges are disjoint, so only the last one starting at or before pc can contain it
+    auto iter = std::upper_bound(stepRanges_.begin(), stepRanges_.end(), pc,
+        [](uint32_t offset, const JSPtStepRange &range) { return offset < range.startBcOffset; });
+    if (iter == stepRanges_.begin()) {
+        return false;
     }
-    return false;
+    --iter;
+    return pc < iter->endBcOffset;
 }
 
-bool SingleStepper::StepComplete(uint32_t bcOffset) const
+bool SingleStepper::StepComplete(const JSPtLocation &location)
 {
-    std::unique_ptr<PtMethod> ptMethod = DebuggerApi::GetMethod(ecmaVm_);
-    uint32_t stackDepth = GetStackDepth();
-
+    if (skippedFrameSp_ != nullptr) {
+        // the stack grows downwards, the skipped frame and the ones it calls are at or below its sp
+        if (GetFrameSp() <= skippedFrameSp_) {
+            return false;
+        }
+        skippedFrameSp_ = nullptr;
+    }
     switch (type_) {
         case Type::STEP_INTO: {
-            if ((method_->GetMethodId() == ptMethod->GetMethodId()) &&
-                (method_->GetJSPandaFile() == ptMethod->GetJSPandaFile()) &&
-                (InStepRange(bcOffset))) {
+            if ((method_->GetMethodId() == location.GetMethodId()) &&
+                (method_->GetJSPandaFile() == location.GetJsPandaFile()) &&
+                (InStepRange(location.GetBytecodeOffset()))) {
                 return false;
             }
             break;
         }
         case Type::STEP_OVER: {
-            if (stackDepth_ < stackDepth) {
+            // the stack grows downwards, a lower sp is a frame called from the stepping one
+            JSTaggedType *sp = GetFrameSp();
+            if (sp < frameSp_) {
                 return false;
             }
-            if (stackDepth_ == stackDepth && InStepRange(bcOffset)) {
+            if (sp == frameSp_ && InStepRange(location.GetBytecodeOffset())) {
                 return false;
             }
             break;
         }
         case Type::STEP_OUT: {
-            if (stackDepth_ <= stackDepth) {
+            if (GetFrameSp() <= frameSp_) {
                 return false;
             }
             break;
@@ -86,12 +106,12 @@ std::unique_ptr<SingleStepper> SingleStepper::GetStepOutStepper(const EcmaVM *ec
     return GetStepper(ecmaVm, SingleStepper::Type::STEP_OUT);
 }
 
-std::list<JSPtStepRange> SingleStepper::GetStepRanges(DebugInfoExtractor *extractor,
+std::vector<JSPtStepRange> SingleStepper::GetStepRanges(DebugInfoExtractor *extractor,
     panda_file::File::EntityId methodId, uint32_t offset)
 {
-    std::list<JSPtStepRange> ranges {};
+    std::vector<JSPtStepRange> ranges {};
     const LineNumberTable &table = extractor->GetLineNumberTable(methodId);
-    auto callbackFunc = [table, &ranges](int32_t line) -> bool {
+    auto callbackFunc = [&table, &ranges](int32_t line) -> bool {
         for (auto it = table.begin(); it != table.end(); ++it) {
             auto next = it + 1;
             if (it->line == line) {
@@ -102,6 +122,9 @@ std::list<JSPtStepRange> SingleStepper::GetStepRanges(DebugInfoExtractor *extrac
         return true;
     };
     extractor->MatchLineWithOffset(callbackFunc, methodId, offset);
+    std::sort(ranges.begin(), ranges.end(), [](const JSPtStepRange &lhs, const JSPtStepRange &rhs) {
+        return lhs.startBcOffset < rhs.startBcOffset;
+    });
     return ranges;
 }
 
@@ -119,10 +142,10 @@ std::unique_ptr<SingleStepper> SingleStepper::GetStepper(const EcmaVM *ecmaVm,
     }
 
     if (type == SingleStepper::Type::STEP_OUT) {
-        return std::make_unique<SingleStepper>(ecmaVm, std::move(ptMethod), std::list<JSPtStepRange> {}, type);
+        return std::make_unique<SingleStepper>(ecmaVm, std::move(ptMethod), std::vector<JSPtStepRange> {}, type);
     }
 
-    std::list<JSPtStepRange> ranges = GetStepRanges(extractor, ptMethod->GetMethodId(),
+    std::vector<JSPtStepRange> ranges = GetStepRanges(extractor, ptMethod->GetMethodId(),
         DebuggerApi::GetBytecodeOffset(ecmaVm));
     return std::make_unique<SingleStepper>(ecmaVm, std::move(ptMethod), std::move(ranges), type);
 }
@@ -28,18 +28,23 @@ class SingleStepper {
 public:
     enum class Type { STEP_INTO, STEP_OVER, STEP_OUT };
     SingleStepper(const EcmaVM *ecmaVm, std::unique_ptr<PtMethod> ptMethod,
-        std::list<JSPtStepRange> stepRanges, Type type)
+        std::vector<JSPtStepRange> stepRanges, Type type)
         : ecmaVm_(ecmaVm),
           method_(std::move(ptMethod)),
           stepRanges_(std::move(stepRanges)),
-          stackDepth_(GetStackDepth()),
+          frameSp_(GetFrameSp()),
           type_(type) {}
 
     virtual ~SingleStepper() = default;
     NO_COPY_SEMANTIC(SingleStepper);
     NO_MOVE_SEMANTIC(SingleStepper);
 
-    bool StepComplete(uint32_t bcOffset) const;
+    bool StepComplete(const JSPtLocation &location);
+    // the step goes on once the current frame, and the calls made from it, return
+    void SkipCurrentFrame()
+    {
+        skippedFrameSp_ = GetFrameSp();
+    }
     Type GetStepperType() const
     {
         return type_;
@@ -50,16 +55,19 @@ public:
     static std::unique_ptr<SingleStepper> GetStepOutStepper(const EcmaVM *ecmaVm);
 
 private:
-    uint32_t GetStackDepth() const;
+    JSTaggedType *GetFrameSp() const;
     bool InStepRange(uint32_t pc) const;
-    static std::list<JSPtStepRange> GetStepRanges(DebugInfoExtractor *extractor,
+    static std::vector<JSPtStepRange> GetStepRanges(DebugInfoExtractor *extractor,
         panda_file::File::EntityId methodId, uint32_t offset);
     static std::unique_ptr<SingleStepper> GetStepper(const EcmaVM *ecmaVm, SingleStepper::Type type);
 
     const EcmaVM *ecmaVm_;
     std::unique_ptr<PtMethod> method_;
-    std::list<JSPtStepRange> stepRanges_;
-    uint32_t stackDepth_;
+    // sorted by startBcOffset
+    std::vector<JSPtStepRange> stepRanges_;
+    // the frame the step started in, frames of deeper calls are below it on the stack
+    JSTaggedType *frameSp_;
+    JSTaggedType *skippedFrameSp_ {nullptr};
     Type type_;
 };
 }  // namespace panda::ecmascript::tooling
@@ -15,6 +15,16 @@
 
 #include "tooling/dynamic/base/pt_base64.h"
 
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define PT_BASE64_USE_NEON
+#elif (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <tmmintrin.h>
+#define PT_BASE64_USE_SSSE3
+#endif
+
 namespace panda::ecmascript::tooling {
 static const unsigned char DECODE_TABLE[] = {
     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
@@ -41,6 +51,160 @@ static const char ENCODE_TABLE[] = {
     "0123456789+/"
 };
 
+#if defined(PT_BASE64_USE_SSSE3)
+#define PT_BASE64_TARGET_SSSE3 __attribute__((target("ssse3")))
+
+static bool IsSsse3Supported()
+{
+#if defined(__SSSE3__)
+    return true;
+#else
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+#endif
+}
+
+// 12 bytes in, 16 chars out, the vector loads 16 bytes so at least 16 bytes must be readable
+PT_BASE64_TARGET_SSSE3 static std::size_t EncodeBlocks(char *dest, const unsigned char *src, std::size_t len)
+{
+    constexpr std::size_t blockIn = 12;
+    constexpr std::size_t blockOut = 16;
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    // map the 6bits index to the distance of its char: A-Z, a-z, 0-9, '+', '/'
+    const __m128i shiftLut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    std::size_t processed = 0;
+    while (len - processed >= blockOut) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + processed));
+        in = _mm_shuffle_epi8(in, shuffle);
+        // split every 3 bytes into 4 indices of 6bits
+        __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(t1, t3);
+
+        __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51)); // 51: 52..63 reduced to 1..12
+        __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices); // 26: 0..25 reduced to 13
+        reduced = _mm_or_si128(reduced, _mm_and_si128(less, _mm_set1_epi8(13))); // 13: index of 'A'
+        __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(shiftLut, reduced), indices);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), chars);
+
+        processed += blockIn;
+        dest += blockOut;
+    }
+    return processed;
+}
+
+// 16 chars in, 12 bytes out, stop at the first block containing '=' or an invalid char
+PT_BASE64_TARGET_SSSE3 static std::size_t DecodeBlocks(char *dest, const unsigned char *src, std::size_t len)
+{
+    constexpr std::size_t blockIn = 16;
+    constexpr std::size_t blockOut = 12;
+    // a char is valid only if the bits of its high nibble and low nibble are disjoint in the two tables
+    const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask2F = _mm_set1_epi8(0x2F);
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    std::size_t processed = 0;
+    alignas(16) char out[blockIn];
+    while (len - processed >= blockIn) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + processed));
+        __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask2F); // 4: shift 4bits
+        __m128i loNibbles = _mm_and_si128(in, mask2F);
+        __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+        __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0) {
+            break;
+        }
+
+        __m128i eq2F = _mm_cmpeq_epi8(in, mask2F);
+        __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles));
+        __m128i values = _mm_add_epi8(in, roll);
+        // merge 4 values of 6bits into 3 bytes
+        __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        merged = _mm_shuffle_epi8(merged, shuffle);
+        // the output buffer may only have 12 bytes left
+        _mm_store_si128(reinterpret_cast<__m128i *>(out), merged);
+        std::memcpy(dest, out, blockOut);
+
+        processed += blockIn;
+        dest += blockOut;
+    }
+    return processed;
+}
+#elif defined(PT_BASE64_USE_NEON)
+// 48 bytes in, 64 chars out
+static std::size_t EncodeBlocks(char *dest, const unsigned char *src, std::size_t len)
+{
+    constexpr std::size_t blockIn = 48;
+    constexpr std::size_t blockOut = 64;
+    const auto *table = reinterpret_cast<const uint8_t *>(ENCODE_TABLE);
+    const uint8x16x4_t encodeTable = {{vld1q_u8(table), vld1q_u8(table + 16), vld1q_u8(table + 32),
+                                       vld1q_u8(table + 48)}}; // 16, 32, 48: offset of the sub tables
+    const uint8x16_t mask = vdupq_n_u8(0x3f);
+    std::size_t processed = 0;
+    while (len - processed >= blockIn) {
+        uint8x16x3_t in = vld3q_u8(src + processed);
+        uint8x16x4_t out;
+        out.val[0] = vshrq_n_u8(in.val[0], 2); // 2: shift 2bits
+        out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask); // 4: 4bits
+        out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask); // 2, 6: bits
+        out.val[3] = vandq_u8(in.val[2], mask); // 3: the fourth char
+        for (auto &chars : out.val) {
+            chars = vqtbl4q_u8(encodeTable, chars);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t *>(dest), out);
+
+        processed += blockIn;
+        dest += blockOut;
+    }
+    return processed;
+}
+
+// 64 chars in, 48 bytes out, stop at the first block containing '=' or an invalid char
+static std::size_t DecodeBlocks(char *dest, const unsigned char *src, std::size_t len)
+{
+    constexpr std::size_t blockIn = 64;
+    constexpr std::size_t blockOut = 48;
+    // only the chars below 128 may be valid, look them up by two tables of 64 entries
+    const uint8x16x4_t decodeTableLo = {{vld1q_u8(DECODE_TABLE), vld1q_u8(DECODE_TABLE + 16),
+                                         vld1q_u8(DECODE_TABLE + 32), vld1q_u8(DECODE_TABLE + 48)}};
+    const uint8x16x4_t decodeTableHi = {{vld1q_u8(DECODE_TABLE + 64), vld1q_u8(DECODE_TABLE + 80),
+                                         vld1q_u8(DECODE_TABLE + 96), vld1q_u8(DECODE_TABLE + 112)}};
+    const uint8x16_t offset = vdupq_n_u8(64); // 64: size of the low table
+    const uint8x16_t highBit = vdupq_n_u8(0x80);
+    std::size_t processed = 0;
+    while (len - processed >= blockIn) {
+        uint8x16x4_t in = vld4q_u8(src + processed);
+        uint8x16_t error = vdupq_n_u8(0);
+        for (auto &chars : in.val) {
+            uint8x16_t values = vqtbl4q_u8(decodeTableLo, chars);
+            values = vqtbx4q_u8(values, decodeTableHi, vsubq_u8(chars, offset));
+            error = vorrq_u8(error, vorrq_u8(values, vandq_u8(chars, highBit)));
+            chars = values;
+        }
+        if (vmaxvq_u8(error) >= 64) { // 64: valid values are 0..63
+            break;
+        }
+
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4)); // 2, 4: shift bits
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2)); // 2, 4: shift bits
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]); // 6: shift 6bits, 3: the fourth char
+        vst3q_u8(reinterpret_cast<uint8_t *>(dest), out);
+
+        processed += blockIn;
+        dest += blockOut;
+    }
+    return processed;
+}
+#endif
+
 std::pair<std::size_t, bool> PtBase64::Decode(void *output, const char *input, std::size_t len)
 {
     if (len < ENCODED_GROUP_BYTES || len % ENCODED_GROUP_BYTES != 0) {
@@ -49,6 +213,34 @@ std::pair<std::size_t, bool> PtBase64::Decode(void *output, const char *input, s
 
     auto *src = reinterpret_cast<unsigned char const *>(input);
     char *dest = static_cast<char *>(output);
+#if defined(PT_BASE64_USE_SSSE3) || defined(PT_BASE64_USE_NEON)
+#if defined(PT_BASE64_USE_SSSE3)
+    if (IsSsse3Supported())
+#endif
+    {
+        // the blocks are made up of whole groups, so the scalar decoding goes on at the group boundary
+        std::size_t processed = DecodeBlocks(dest, src, len);
+        dest += processed / ENCODED_GROUP_BYTES * UNENCODED_GROUP_BYTES;
+        src += processed;
+        len -= processed;
+    }
+#endif
+    return DecodeRemaining(static_cast<char *>(output), dest, src, len);
+}
+
+std::pair<std::size_t, bool> PtBase64::DecodeScalar(void *output, const char *input, std::size_t len)
+{
+    if (len < ENCODED_GROUP_BYTES || len % ENCODED_GROUP_BYTES != 0) {
+        return {0, false};
+    }
+
+    auto *src = reinterpret_cast<unsigned char const *>(input);
+    return DecodeRemaining(static_cast<char *>(output), static_cast<char *>(output), src, len);
+}
+
+std::pair<std::size_t, bool> PtBase64::DecodeRemaining(char *output, char *dest, const unsigned char *src,
+                                                       std::size_t len)
+{
     char base64Chars[ENCODED_GROUP_BYTES];
     int8_t i = 0;
     while (len-- && *src != '=') {
@@ -78,7 +270,7 @@ std::pair<std::size_t, bool> PtBase64::Decode(void *output, const char *input, s
     }
 
     len++; // get the remaining length and also avoid underflow
-    size_t decodedLen = dest - static_cast<char *>(output);
+    size_t decodedLen = dest - output;
     bool decodedDone = false;
     // 0: decodedDone, 1: =, 2: ==
     if (len == 0 || (len == 1 && *src == '=') || (len == 2 && *src == '=' && *(src + 1) == '=')) {
@@ -96,6 +288,31 @@ size_t PtBase64::Encode(char *output, const void *input, std::size_t len)
 
     auto *src = static_cast<const unsigned char *>(input);
     char *dest = output;
+#if defined(PT_BASE64_USE_SSSE3) || defined(PT_BASE64_USE_NEON)
+#if defined(PT_BASE64_USE_SSSE3)
+    if (IsSsse3Supported())
+#endif
+    {
+        std::size_t processed = EncodeBlocks(dest, src, len);
+        dest += processed / UNENCODED_GROUP_BYTES * ENCODED_GROUP_BYTES;
+        src += processed;
+        len -= processed;
+    }
+#endif
+    return EncodeRemaining(dest, src, len) - output;
+}
+
+size_t PtBase64::EncodeScalar(char *output, const void *input, std::size_t len)
+{
+    if (len == 0) {
+        return 0;
+    }
+
+    return EncodeRemaining(output, static_cast<const unsigned char *>(input), len) - output;
+}
+
+char *PtBase64::EncodeRemaining(char *dest, const unsigned char *src, std::size_t len)
+{
     for (auto n = len / UNENCODED_GROUP_BYTES; n--;) {
         *dest++ = ENCODE_TABLE[src[0] >> 2]; // 2: shift 2bits
         *dest++ = ENCODE_TABLE[((src[0] & 0x03) << 4) | (src[1] >> 4)]; // 4: shift 4bits
@@ -123,6 +340,6 @@ size_t PtBase64::Encode(char *output, const void *input, std::size_t len)
         default:
             break;
     }
-    return dest - output;
+    return dest;
 }
 }  // namespace panda::ecmascript::tooling
\ No newline at end of file
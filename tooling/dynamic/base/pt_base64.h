@@ -35,10 +35,18 @@ public:
         return ENCODED_GROUP_BYTES * ((n + 2) / UNENCODED_GROUP_BYTES); // 2: byte filling
     }
 
+    // Decode and Encode use the SIMD implementation (SSSE3 or NEON) for the bulk of the input when it is
+    // supported, the results are exactly the same as the scalar version including the error cases.
     static std::pair<std::size_t, bool> Decode(void *output, const char *input, std::size_t len);
     static size_t Encode(char *output, const void *input, std::size_t len);
+    static std::pair<std::size_t, bool> DecodeScalar(void *output, const char *input, std::size_t len);
+    static size_t EncodeScalar(char *output, const void *input, std::size_t len);
 
 private:
+    static std::pair<std::size_t, bool> DecodeRemaining(char *output, char *dest, const unsigned char *src,
+                                                        std::size_t len);
+    static char *EncodeRemaining(char *dest, const unsigned char *src, std::size_t len);
+
    static constexpr uint8_t UNENCODED_GROUP_BYTES = 3;
    static constexpr uint8_t ENCODED_GROUP_BYTES = 4;
    static constexpr uint8_t INVAILD_VALUE = 255;
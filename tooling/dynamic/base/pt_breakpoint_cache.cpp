@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tooling/dynamic/base/pt_breakpoint_cache.h"
+
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+
+namespace panda::ecmascript::tooling {
+bool PtBreakpointCache::Load(const std::string &path)
+{
+    path_ = path;
+    entries_.clear();
+    pendingLines_.clear();
+    std::ifstream file(path_);
+    if (!file.is_open()) {
+        // a file which exists but can not be read is not ours either
+        struct stat info {};
+        if (stat(path_.c_str(), &info) == 0) {
+            Disable();
+            return false;
+        }
+        // a new file, created by the first Flush
+        pendingLines_ = std::string(FILE_HEADER) + '\n';
+        return true;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != FILE_HEADER) {
+        Disable();
+        return false;
+    }
+    size_t lineCount = 0;
+    while (std::getline(file, line)) {
+        lineCount++;
+        EntryKey key;
+        Entry entry;
+        if (!ParseEntry(line, &key, &entry)) {
+            Disable();
+            return false;
+        }
+        entries_[key] = std::move(entry);
+    }
+    file.close();
+    if (lineCount != entries_.size() && !Rewrite()) {
+        Disable();
+        return false;
+    }
+    return true;
+}
+
+void PtBreakpointCache::Disable()
+{
+    path_.clear();
+    entries_.clear();
+    pendingLines_.clear();
+}
+
+const std::vector<BreakpointCacheLocation> *PtBreakpointCache::Find(uint32_t checksum, const std::string &url,
+    int32_t lineNumber) const
+{
+    auto iter = entries_.find(std::make_pair(url, lineNumber));
+    if (iter == entries_.end() || iter->second.checksum != checksum) {
+        return nullptr;
+    }
+    return &iter->second.locations;
+}
+
+void PtBreakpointCache::Insert(uint32_t checksum, const std::string &url, int32_t lineNumber,
+    const std::vector<BreakpointCacheLocation> &locations)
+{
+    EntryKey key = std::make_pair(url, lineNumber);
+    Entry &entry = entries_[key];
+    entry.checksum = checksum;
+    entry.locations = locations;
+    pendingLines_ += FormatEntry(key, entry);
+}
+
+bool PtBreakpointCache::Flush()
+{
+    if (!IsEnabled() || entries_.empty() || pendingLines_.empty()) {
+        return true;
+    }
+    std::ofstream file(path_, std::ios::app);
+    file << pendingLines_;
+    pendingLines_.clear();
+    return file.good();
+}
+
+bool PtBreakpointCache::Rewrite()
+{
+    // only a file read through to its end is compacted
+    std::string lines = std::string(FILE_HEADER) + '\n';
+    for (const auto &[key, entry] : entries_) {
+        lines += FormatEntry(key, entry);
+    }
+    std::ofstream file(path_, std::ios::trunc);
+    file << lines;
+    return file.good();
+}
+
+// <checksum> <line> <count> <methodId> <offset>... <url>, the url last as it may contain spaces
+std::string PtBreakpointCache::FormatEntry(const EntryKey &key, const Entry &entry)
+{
+    std::ostringstream line;
+    line << entry.checksum << ' ' << key.second << ' ' << entry.locations.size();
+    for (const auto &location : entry.locations) {
+        line << ' ' << location.methodId << ' ' << location.offset;
+    }
+    line << ' ' << key.first << '\n';
+    return line.str();
+}
+
+bool PtBreakpointCache::ParseEntry(const std::string &line, EntryKey *key, Entry *entry)
+{
+    std::istringstream stream(line);
+    size_t count = 0;
+    if (!(stream >> entry->checksum >> key->second >> count)) {
+        return false;
+    }
+    // a location takes at least 4 characters, more than the line has is a corrupted count
+    if (count > line.size()) {
+        return false;
+    }
+    entry->locations.resize(count);
+    for (auto &location : entry->locations) {
+        if (!(stream >> location.methodId >> location.offset)) {
+            return false;
+        }
+    }
+    // skip the space before the url
+    if (stream.get() != ' ' || !std::getline(stream, key->first) || key->first.empty()) {
+        return false;
+    }
+    return true;
+}
+}  // namespace panda::ecmascript::tooling
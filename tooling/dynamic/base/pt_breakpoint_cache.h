@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_BASE_PT_BREAKPOINT_CACHE_H
+#define ECMASCRIPT_TOOLING_BASE_PT_BREAKPOINT_CACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/macros.h"
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript::tooling {
+struct BreakpointCacheLocation {
+    uint32_t methodId {0};
+    uint32_t offset {0};
+};
+
+// The locations the pending breakpoints of launch accelerate mode resolved to, kept on disk so that
+// a later launch of the same abc sets them without matching the line tables again.
+// An entry is keyed by the url:line of the breakpoint and only hits for the checksum of the abc it was
+// resolved in, a changed abc resolves and replaces it. The file starts with FILE_HEADER and is appended
+// one line per entry, and compacted on load when some of its lines are replaced.
+// The path comes from the frontend, so a file without the header or with a line that does not parse is
+// not written to at all.
+class TOOLCHAIN_EXPORT PtBreakpointCache final {
+public:
+    static constexpr const char *FILE_HEADER = "# ark debugger breakpoints cache v1";
+
+    PtBreakpointCache() = default;
+    ~PtBreakpointCache() = default;
+
+    // Reads the entries of the file, a missing file is an empty cache created on the first Flush.
+    // Returns false and leaves the cache disabled if the file is not a cache file or could not be compacted
+    bool Load(const std::string &path);
+    const std::vector<BreakpointCacheLocation> *Find(uint32_t checksum, const std::string &url,
+        int32_t lineNumber) const;
+    void Insert(uint32_t checksum, const std::string &url, int32_t lineNumber,
+        const std::vector<BreakpointCacheLocation> &locations);
+    // Appends the entries inserted since the last flush to the file
+    bool Flush();
+
+    bool IsEnabled() const
+    {
+        return !path_.empty();
+    }
+
+    size_t GetSize() const
+    {
+        return entries_.size();
+    }
+
+private:
+    NO_COPY_SEMANTIC(PtBreakpointCache);
+    NO_MOVE_SEMANTIC(PtBreakpointCache);
+
+    struct Entry {
+        uint32_t checksum {0};
+        std::vector<BreakpointCacheLocation> locations {};
+    };
+    using EntryKey = std::pair<std::string, int32_t>;
+
+    static std::string FormatEntry(const EntryKey &key, const Entry &entry);
+    static bool ParseEntry(const std::string &line, EntryKey *key, Entry *entry);
+    bool Rewrite();
+
+    void Disable();
+
+    std::string path_ {};
+    std::map<EntryKey, Entry> entries_ {};
+    std::string pendingLines_ {};
+};
+}  // namespace panda::ecmascript::tooling
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tooling/dynamic/base/pt_debug_info_cache.h"
+
+namespace panda::ecmascript::tooling {
+int32_t FileDebugInfo::GetEndLine(const std::string &url, const EndLinesScanner &scanner)
+{
+    std::unique_lock<std::mutex> lock(endLinesLock_);
+    if (!endLinesScanned_) {
+        endLines_ = scanner();
+        endLinesScanned_ = true;
+    }
+    auto iter = endLines_.find(url);
+    return iter == endLines_.end() ? 0 : iter->second;
+}
+
+size_t FileDebugInfo::GetSourceFileCount()
+{
+    std::unique_lock<std::mutex> lock(endLinesLock_);
+    return endLines_.size();
+}
+
+PtDebugInfoCache *PtDebugInfoCache::GetInstance()
+{
+    static PtDebugInfoCache *instance = new PtDebugInfoCache();
+    return instance;
+}
+
+std::shared_ptr<FileDebugInfo> PtDebugInfoCache::Acquire(const DebugInfoFileKey &key)
+{
+    std::unique_lock<std::mutex> lock(filesLock_);
+    auto iter = files_.find(key);
+    if (iter != files_.end()) {
+        std::shared_ptr<FileDebugInfo> fileDebugInfo = iter->second.lock();
+        if (fileDebugInfo != nullptr) {
+            return fileDebugInfo;
+        }
+    }
+    SweepReleasedFiles();
+    auto fileDebugInfo = std::make_shared<FileDebugInfo>();
+    files_[key] = fileDebugInfo;
+    return fileDebugInfo;
+}
+
+size_t PtDebugInfoCache::GetFileCount()
+{
+    std::unique_lock<std::mutex> lock(filesLock_);
+    SweepReleasedFiles();
+    return files_.size();
+}
+
+void PtDebugInfoCache::SweepReleasedFiles()
+{
+    for (auto iter = files_.begin(); iter != files_.end();) {
+        if (iter->second.expired()) {
+            iter = files_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+}  // namespace panda::ecmascript::tooling
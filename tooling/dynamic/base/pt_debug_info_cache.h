@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_BASE_PT_DEBUG_INFO_CACHE_H
+#define ECMASCRIPT_TOOLING_BASE_PT_DEBUG_INFO_CACHE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/macros.h"
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript::tooling {
+// What a debugger reads from the debug info of a method when its script is parsed.
+struct ScriptDebugInfo {
+    std::string url {};
+    int32_t endLine {0};
+};
+
+// The identity of a panda file, the same for every VM of the process that loads it.
+struct DebugInfoFileKey {
+    std::string fileName {};
+    uint32_t checksum {0};
+
+    bool operator<(const DebugInfoFileKey &other) const
+    {
+        return fileName < other.fileName || (fileName == other.fileName && checksum < other.checksum);
+    }
+};
+
+// The end lines of the source files of one panda file, shared by the debuggers of all the VMs.
+// They take a walk over the line tables of every method of the file, which each worker loading the
+// modules.abc of its main thread would redo otherwise. Workers parse their scripts on their own threads,
+// so the end lines are protected by a lock.
+class TOOLCHAIN_EXPORT FileDebugInfo final {
+public:
+    // the last line with code of each source file of the panda file
+    using EndLines = std::unordered_map<std::string, int32_t>;
+    using EndLinesScanner = std::function<EndLines()>;
+
+    FileDebugInfo() = default;
+    ~FileDebugInfo() = default;
+
+    // Returns the end line of the source file url, calling the scanner only for the first debugger asking
+    // for an url of the file.
+    int32_t GetEndLine(const std::string &url, const EndLinesScanner &scanner);
+    size_t GetSourceFileCount();
+
+private:
+    NO_COPY_SEMANTIC(FileDebugInfo);
+    NO_MOVE_SEMANTIC(FileDebugInfo);
+
+    std::mutex endLinesLock_;
+    bool endLinesScanned_ {false};
+    EndLines endLines_ {};
+};
+
+// Process-wide registry of the FileDebugInfo. Each debugger holds a reference to the files it parsed
+// scripts from, and a file is released once no debugger of any VM holds it.
+class TOOLCHAIN_EXPORT PtDebugInfoCache final {
+public:
+    static PtDebugInfoCache *GetInstance();
+
+    std::shared_ptr<FileDebugInfo> Acquire(const DebugInfoFileKey &key);
+    size_t GetFileCount();
+
+private:
+    PtDebugInfoCache() = default;
+    ~PtDebugInfoCache() = default;
+    NO_COPY_SEMANTIC(PtDebugInfoCache);
+    NO_MOVE_SEMANTIC(PtDebugInfoCache);
+
+    void SweepReleasedFiles();
+
+    std::mutex filesLock_;
+    std::map<DebugInfoFileKey, std::weak_ptr<FileDebugInfo>> files_ {};
+};
+}  // namespace panda::ecmascript::tooling
+#endif
@@ -54,8 +54,13 @@ std::unique_ptr<PtJson> Paused::ToJson() const
         }
         result->Add("hitBreakpoints", breakpoints);
     }
+    if (hasMore_) {
+        result->Add("hasMore", hasMore_.value());
+    }
 
-    if (asyncStack_ && asyncCallChainDepth_) {
+    if (asyncStackTrace_ != nullptr) {
+        result->Add("asyncStackTrace", asyncStackTrace_->ToJson());
+    } else if (asyncStack_ && asyncCallChainDepth_) {
         result->Add("asyncStackTrace", ToJson(*asyncStack_, asyncCallChainDepth_ - 1));
     }
 
@@ -200,6 +205,17 @@ std::unique_ptr<PtJson> ScriptFailedToParse::ToJson() const
 }
 
 std::unique_ptr<PtJson> ScriptParsed::ToJson() const
+{
+    std::unique_ptr<PtJson> result = ParamsToJson();
+
+    std::unique_ptr<PtJson> object = PtJson::CreateObject();
+    object->Add("method", GetName().c_str());
+    object->Add("params", result);
+
+    return object;
+}
+
+std::unique_ptr<PtJson> ScriptParsed::ParamsToJson() const
 {
     std::unique_ptr<PtJson> result = PtJson::CreateObject();
 
@@ -245,6 +261,44 @@ std::unique_ptr<PtJson> ScriptParsed::ToJson() const
     }
     result->Add("locations", array);
 
+    return result;
+}
+
+std::unique_ptr<PtJson> ScriptsParsed::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    std::unique_ptr<PtJson> array = PtJson::CreateArray();
+    size_t len = scripts_.size();
+    for (size_t i = 0; i < len; i++) {
+        ASSERT(scripts_[i] != nullptr);
+        std::unique_ptr<PtJson> script = scripts_[i]->ParamsToJson();
+        array->Push(script);
+    }
+    result->Add("scripts", array);
+
+    std::unique_ptr<PtJson> object = PtJson::CreateObject();
+    object->Add("method", GetName().c_str());
+    object->Add("params", result);
+
+    return object;
+}
+
+std::unique_ptr<PtJson> ConsoleAPICalled::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    result->Add("type", type_.c_str());
+    std::unique_ptr<PtJson> array = PtJson::CreateArray();
+    size_t len = args_.size();
+    for (size_t i = 0; i < len; i++) {
+        ASSERT(args_[i] != nullptr);
+        array->Push(args_[i]->ToJson());
+    }
+    result->Add("args", array);
+    result->Add("executionContextId", executionContextId_);
+    result->Add("timestamp", timestamp_);
+
     std::unique_ptr<PtJson> object = PtJson::CreateObject();
     object->Add("method", GetName().c_str());
     object->Add("params", result);
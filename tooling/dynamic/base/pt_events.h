@@ -213,6 +213,18 @@ public:
         return asyncCallChainDepth_;
     }
 
+    // the top segment of the async stack with its parent referred to by id, sent instead of the whole chain
+    const StackTrace *GetAsyncStackTrace() const
+    {
+        return asyncStackTrace_.get();
+    }
+
+    Paused &SetAsyncStackTrace(std::unique_ptr<StackTrace> asyncStackTrace)
+    {
+        asyncStackTrace_ = std::move(asyncStackTrace);
+        return *this;
+    }
+
     std::vector<BreakpointId> GetHitBreakpoints() const
     {
         return hitBreakpoints_.value_or(std::vector<BreakpointId>());
@@ -229,15 +241,29 @@ public:
         return hitBreakpoints_.has_value();
     }
 
+    bool GetHasMore() const
+    {
+        return hasMore_.value_or(false);
+    }
+
+    Paused &SetHasMore(bool hasMore)
+    {
+        hasMore_ = hasMore;
+        return *this;
+    }
+
 private:
     NO_COPY_SEMANTIC(Paused);
     NO_MOVE_SEMANTIC(Paused);
 
     std::vector<std::unique_ptr<CallFrame>> callFrames_ {};
     std::shared_ptr<AsyncStack> asyncStack_ {};
+    std::unique_ptr<StackTrace> asyncStackTrace_ {};
     std::string reason_ {};
     std::optional<std::unique_ptr<RemoteObject>> data_ {};
     std::optional<std::vector<BreakpointId>> hitBreakpoints_ {};
+    // only the first frames are sent, the rest can be fetched by Debugger.getCallFrames
+    std::optional<bool> hasMore_ {};
     int32_t asyncCallChainDepth_ {0};
 };
 
@@ -596,6 +622,7 @@ public:
     ScriptParsed() = default;
     ~ScriptParsed() override = default;
     std::unique_ptr<PtJson> ToJson() const override;
+    std::unique_ptr<PtJson> ParamsToJson() const;
 
     std::string GetName() const override
     {
@@ -867,6 +894,102 @@ private:
     std::vector<std::shared_ptr<BreakpointReturnInfo>> locations_ {};
 };
 
+// The scripts already parsed when the debugger is enabled, sent in chunks instead of one
+// Debugger.scriptParsed per script
+class ScriptsParsed final : public PtBaseEvents {
+public:
+    ScriptsParsed() = default;
+    ~ScriptsParsed() override = default;
+    std::unique_ptr<PtJson> ToJson() const override;
+
+    std::string GetName() const override
+    {
+        return "Debugger.scriptsParsed";
+    }
+
+    const std::vector<std::unique_ptr<ScriptParsed>> *GetScripts() const
+    {
+        return &scripts_;
+    }
+
+    ScriptsParsed &SetScripts(std::vector<std::unique_ptr<ScriptParsed>> scripts)
+    {
+        scripts_ = std::move(scripts);
+        return *this;
+    }
+
+private:
+    NO_COPY_SEMANTIC(ScriptsParsed);
+    NO_MOVE_SEMANTIC(ScriptsParsed);
+
+    std::vector<std::unique_ptr<ScriptParsed>> scripts_ {};
+};
+
+class ConsoleAPICalled final : public PtBaseEvents {
+public:
+    ConsoleAPICalled() = default;
+    ~ConsoleAPICalled() override = default;
+    std::unique_ptr<PtJson> ToJson() const override;
+
+    std::string GetName() const override
+    {
+        return "Runtime.consoleAPICalled";
+    }
+
+    const std::string &GetType() const
+    {
+        return type_;
+    }
+
+    ConsoleAPICalled &SetType(const std::string &type)
+    {
+        type_ = type;
+        return *this;
+    }
+
+    const std::vector<std::unique_ptr<RemoteObject>> *GetArgs() const
+    {
+        return &args_;
+    }
+
+    ConsoleAPICalled &SetArgs(std::vector<std::unique_ptr<RemoteObject>> args)
+    {
+        args_ = std::move(args);
+        return *this;
+    }
+
+    ExecutionContextId GetExecutionContextId() const
+    {
+        return executionContextId_;
+    }
+
+    ConsoleAPICalled &SetExecutionContextId(ExecutionContextId executionContextId)
+    {
+        executionContextId_ = executionContextId;
+        return *this;
+    }
+
+    double GetTimestamp() const
+    {
+        return timestamp_;
+    }
+
+    ConsoleAPICalled &SetTimestamp(double timestamp)
+    {
+        timestamp_ = timestamp;
+        return *this;
+    }
+
+private:
+    NO_COPY_SEMANTIC(ConsoleAPICalled);
+    NO_MOVE_SEMANTIC(ConsoleAPICalled);
+
+    std::string type_ {};
+    std::vector<std::unique_ptr<RemoteObject>> args_ {};
+    ExecutionContextId executionContextId_ {0};
+    double timestamp_ {0};
+};
+
 class AddHeapSnapshotChunk final : public PtBaseEvents {
 public:
     AddHeapSnapshotChunk() = default;
@@ -15,7 +15,146 @@
 
 #include "tooling/dynamic/base/pt_json.h"
 
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define PT_JSON_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PT_JSON_USE_SSE2
+#endif
+
 namespace panda::ecmascript::tooling {
+// strings shorter than this are escaped by cJSON itself
+static constexpr size_t FAST_ESCAPE_MIN_LENGTH = 256;
+
+static inline bool NeedEscape(unsigned char ch)
+{
+    return ch < 0x20 || ch == '"' || ch == '\\'; // 0x20: the control characters are below space
+}
+
+// Find the first char which needs escaping in [cur, end), or end if there is none
+static const char *FindEscapeChar(const char *cur, const char *end)
+{
+    constexpr size_t blockSize = 16;
+#if defined(PT_JSON_USE_SSE2)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i maxControl = _mm_set1_epi8(0x1F); // 0x1F: the last control character
+    while (static_cast<size_t>(end - cur) >= blockSize) {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+        __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(chars, maxControl), chars);
+        __m128i mask = _mm_or_si128(isControl,
+            _mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)));
+        int bits = _mm_movemask_epi8(mask);
+        if (bits != 0) {
+            return cur + __builtin_ctz(static_cast<unsigned int>(bits));
+        }
+        cur += blockSize;
+    }
+#elif defined(PT_JSON_USE_NEON)
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t space = vdupq_n_u8(0x20); // 0x20: the control characters are below space
+    while (static_cast<size_t>(end - cur) >= blockSize) {
+        uint8x16_t chars = vld1q_u8(reinterpret_cast<const uint8_t *>(cur));
+        uint8x16_t mask = vorrq_u8(vcltq_u8(chars, space),
+            vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)));
+        if (vmaxvq_u8(mask) != 0) {
+            // the scalar loop below locates it in this block
+            break;
+        }
+        cur += blockSize;
+    }
+#endif
+    while (cur < end && !NeedEscape(static_cast<unsigned char>(*cur))) {
+        cur++;
+    }
+    return cur;
+}
+
+// Same output as the escaping of cJSON: short escapes for the common ones, \u00xx for other control characters
+static void AppendEscapedChar(unsigned char ch, std::string &out)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    out.push_back('\\');
+    switch (ch) {
+        case '"':
+            out.push_back('"');
+            break;
+        case '\\':
+            out.push_back('\\');
+            break;
+        case '\b':
+            out.push_back('b');
+            break;
+        case '\f':
+            out.push_back('f');
+            break;
+        case '\n':
+            out.push_back('n');
+            break;
+        case '\r':
+            out.push_back('r');
+            break;
+        case '\t':
+            out.push_back('t');
+            break;
+        default:
+            out.append("u00");
+            out.push_back(HEX_DIGITS[ch >> 4]); // 4: the high hex digit
+            out.push_back(HEX_DIGITS[ch & 0x0F]);
+            break;
+    }
+}
+
+void PtJson::EscapeString(const char *str, size_t len, std::string &out)
+{
+    const char *end = str + len;
+    const char *cur = str;
+    out.push_back('"');
+    while (true) {
+        const char *next = FindEscapeChar(cur, end);
+        out.append(cur, next - cur);
+        if (next == end) {
+            break;
+        }
+        AppendEscapedChar(static_cast<unsigned char>(*next), out);
+        cur = next + 1;
+    }
+    out.push_back('"');
+}
+
+namespace {
+struct EscapedNode {
+    cJSON *node;
+    char *valueString;
+    int type;
+    std::string escaped;
+};
+}  // namespace
+
+// Escape the large string values in advance and let cJSON print them as raw nodes,
+// the nodes are restored after printing.
+static void EscapeLargeStrings(cJSON *item, std::vector<EscapedNode> &escapedNodes)
+{
+    for (; item != nullptr; item = item->next) {
+        if (cJSON_IsString(item) != 0 && item->valuestring != nullptr) {
+            size_t len = strlen(item->valuestring);
+            if (len >= FAST_ESCAPE_MIN_LENGTH) {
+                EscapedNode &escapedNode = escapedNodes.emplace_back();
+                escapedNode.node = item;
+                escapedNode.valueString = item->valuestring;
+                escapedNode.type = item->type;
+                escapedNode.escaped.reserve(len + len / 8 + 2); // 8: room for some escapes, 2: quotes
+                PtJson::EscapeString(item->valuestring, len, escapedNode.escaped);
+            }
+        } else if (item->child != nullptr) {
+            EscapeLargeStrings(item->child, escapedNodes);
+        }
+    }
+}
 std::unique_ptr<PtJson> PtJson::CreateObject()
 {
     return std::make_unique<PtJson>(cJSON_CreateObject());
@@ -46,7 +185,25 @@ std::string PtJson::Stringify() const
         return "";
     }
 
+    std::vector<EscapedNode> escapedNodes;
+    if (object_->child != nullptr) {
+        EscapeLargeStrings(object_->child, escapedNodes);
+    } else if (cJSON_IsString(object_) != 0 && object_->valuestring != nullptr &&
+        strlen(object_->valuestring) >= FAST_ESCAPE_MIN_LENGTH) {
+        std::string result;
+        EscapeString(object_->valuestring, strlen(object_->valuestring), result);
+        return result;
+    }
+    for (auto &escapedNode : escapedNodes) {
+        // keep the flags of the node, such as cJSON_StringIsConst
+        escapedNode.node->type = (escapedNode.type & ~0xFF) | cJSON_Raw; // 0xFF: mask of the value type
+        escapedNode.node->valuestring = escapedNode.escaped.data();
+    }
     char *str = cJSON_PrintUnformatted(object_);
+    for (auto &escapedNode : escapedNodes) {
+        escapedNode.node->type = escapedNode.type;
+        escapedNode.node->valuestring = escapedNode.valueString;
+    }
     if (str == nullptr) {
         return "";
     }
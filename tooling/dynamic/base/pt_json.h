@@ -46,9 +46,12 @@ public:
     // String parse to json
     static std::unique_ptr<PtJson> Parse(const std::string &data);
 
-    // To string
+    // To string, the large strings are escaped by EscapeString instead of cJSON
     std::string Stringify() const;
 
+    // Append the json string literal of str, including the quotes, to out
+    static void EscapeString(const char *str, size_t len, std::string &out);
+
     // Add Json child
     bool Add(const char *key, bool value) const;
     bool Add(const char *key, int32_t value) const;
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tooling/dynamic/base/pt_metrics.h"
+
+namespace panda::ecmascript::tooling {
+void ProtocolMetrics::RecordCall(const std::string &method, uint64_t time, size_t bytesIn)
+{
+    std::unique_lock<std::mutex> lock(metricsLock_);
+    MethodMetrics &metrics = metrics_[method];
+    metrics.callCount++;
+    metrics.totalTime += time;
+    if (time > metrics.maxTime) {
+        metrics.maxTime = time;
+    }
+    metrics.bytesIn += bytesIn;
+}
+
+void ProtocolMetrics::RecordBytesOut(const std::string &method, size_t bytesOut)
+{
+    std::unique_lock<std::mutex> lock(metricsLock_);
+    metrics_[method].bytesOut += bytesOut;
+}
+
+void ProtocolMetrics::RecordEventOut(const std::string &event, size_t bytesOut)
+{
+    std::unique_lock<std::mutex> lock(metricsLock_);
+    MethodMetrics &metrics = eventMetrics_[event];
+    metrics.callCount++;
+    metrics.bytesOut += bytesOut;
+}
+
+std::map<std::string, MethodMetrics> ProtocolMetrics::GetMetrics() const
+{
+    std::unique_lock<std::mutex> lock(metricsLock_);
+    return metrics_;
+}
+
+std::map<std::string, MethodMetrics> ProtocolMetrics::GetEventMetrics() const
+{
+    std::unique_lock<std::mutex> lock(metricsLock_);
+    return eventMetrics_;
+}
+
+void ProtocolMetrics::Reset()
+{
+    std::unique_lock<std::mutex> lock(metricsLock_);
+    metrics_.clear();
+    eventMetrics_.clear();
+}
+
+void ProtocolMetrics::StartDispatch()
+{
+    dispatchTimers_.push_back({std::chrono::steady_clock::now(), std::nullopt});
+}
+
+void ProtocolMetrics::StopDispatch()
+{
+    if (dispatchTimers_.empty() || dispatchTimers_.back().time.has_value()) {
+        return;
+    }
+    auto cost = std::chrono::steady_clock::now() - dispatchTimers_.back().start;
+    dispatchTimers_.back().time = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(cost).count());
+}
+
+uint64_t ProtocolMetrics::FinishDispatch()
+{
+    if (dispatchTimers_.empty()) {
+        return 0;
+    }
+    // a request without a reply is timed up to the end of its handler
+    StopDispatch();
+    uint64_t time = dispatchTimers_.back().time.value_or(0);
+    dispatchTimers_.pop_back();
+    return time;
+}
+}  // namespace panda::ecmascript::tooling
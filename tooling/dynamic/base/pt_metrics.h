@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_BASE_PT_METRICS_H
+#define ECMASCRIPT_TOOLING_BASE_PT_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/macros.h"
+#include "libpandabase/macros.h"
+
+namespace panda::ecmascript::tooling {
+struct MethodMetrics {
+    uint64_t callCount {0};
+    // time spent in the handler, in microseconds
+    uint64_t totalTime {0};
+    uint64_t maxTime {0};
+    uint64_t bytesIn {0};
+    uint64_t bytesOut {0};
+};
+
+// Per-method statistics of the protocol messages, keyed by "Domain.method".
+// Requests are recorded on the js thread and replies may be recorded on the send thread,
+// so all the records are protected by a lock, which is only taken when the metrics is enabled.
+class TOOLCHAIN_EXPORT ProtocolMetrics final {
+public:
+    ProtocolMetrics() = default;
+    ~ProtocolMetrics() = default;
+
+    void SetEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void RecordCall(const std::string &method, uint64_t time, size_t bytesIn);
+    void RecordBytesOut(const std::string &method, size_t bytesOut);
+    // events are kept apart from the methods, counted by the number and the bytes of those sent out
+    void RecordEventOut(const std::string &event, size_t bytesOut);
+    std::map<std::string, MethodMetrics> GetMetrics() const;
+    std::map<std::string, MethodMetrics> GetEventMetrics() const;
+    void Reset();
+
+    // The handler time of a request, from its dispatch to the start of its reply, so that building and
+    // sending the reply is not counted. Only called on the js thread, a request dispatched while another
+    // is paused in its handler is timed on its own.
+    void StartDispatch();
+    void StopDispatch();
+    uint64_t FinishDispatch();
+
+private:
+    NO_COPY_SEMANTIC(ProtocolMetrics);
+    NO_MOVE_SEMANTIC(ProtocolMetrics);
+
+    std::atomic<bool> enabled_ {false};
+    mutable std::mutex metricsLock_;
+    std::map<std::string, MethodMetrics> metrics_ {};
+    std::map<std::string, MethodMetrics> eventMetrics_ {};
+
+    struct DispatchTimer {
+        std::chrono::steady_clock::time_point start {};
+        // in microseconds, set once the reply starts
+        std::optional<uint64_t> time {};
+    };
+    std::vector<DispatchTimer> dispatchTimers_ {};
+};
+}  // namespace panda::ecmascript::tooling
+#endif
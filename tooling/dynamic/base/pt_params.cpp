@@ -46,6 +46,14 @@ std::unique_ptr<EnableParams> EnableParams::Create(const PtJson &params)
         error += "Wrong type of 'options';";
     }
 
+    std::string breakpointsCachePath;
+    ret = params.GetString("breakpointsCachePath", &breakpointsCachePath);
+    if (ret == Result::SUCCESS) {
+        paramsObject->breakpointsCachePath_ = std::move(breakpointsCachePath);
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'breakpointsCachePath';";
+    }
+
     if (!error.empty()) {
         LOG_DEBUGGER(ERROR) << "EnableParams::Create " << error;
         return nullptr;
@@ -232,6 +240,33 @@ std::unique_ptr<GetScriptSourceParams> GetScriptSourceParams::Create(const PtJso
     return paramsObject;
 }
 
+std::unique_ptr<GetStackTraceParams> GetStackTraceParams::Create(const PtJson &params)
+{
+    auto paramsObject = std::make_unique<GetStackTraceParams>();
+    std::string error;
+    Result ret;
+
+    std::unique_ptr<PtJson> stackTraceId;
+    ret = params.GetObject("stackTraceId", &stackTraceId);
+    if (ret == Result::SUCCESS) {
+        std::unique_ptr<StackTraceId> id = StackTraceId::Create(*stackTraceId);
+        if (id == nullptr) {
+            error += "'stackTraceId' is invalid;";
+        } else {
+            paramsObject->stackTraceId_ = std::move(id);
+        }
+    } else {
+        error += "Unknown or wrong type of 'stackTraceId';";
+    }
+
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "GetStackTraceParams::Create " << error;
+        return nullptr;
+    }
+
+    return paramsObject;
+}
+
 std::unique_ptr<RemoveBreakpointParams> RemoveBreakpointParams::Create(const PtJson &params)
 {
     auto paramsObject = std::make_unique<RemoveBreakpointParams>();
@@ -350,6 +385,46 @@ std::unique_ptr<SetBlackboxPatternsParams> SetBlackboxPatternsParams::Create(con
     return paramsObject;
 }
 
+std::unique_ptr<SetBlackboxedRangesParams> SetBlackboxedRangesParams::Create(const PtJson &params)
+{
+    auto paramsObject = std::make_unique<SetBlackboxedRangesParams>();
+    std::string error;
+    Result ret;
+
+    std::string scriptId;
+    ret = params.GetString("scriptId", &scriptId);
+    if (ret == Result::SUCCESS) {
+        if (!ToolchainUtils::StrToInt32(scriptId, paramsObject->scriptId_)) {
+            error += "Failed to convert 'scriptId' from string to int;";
+        }
+    } else {
+        error += "Unknown or wrong type of 'scriptId';";
+    }
+
+    std::unique_ptr<PtJson> positions;
+    ret = params.GetArray("positions", &positions);
+    if (ret == Result::SUCCESS) {
+        int32_t len = positions->GetSize();
+        for (int32_t i = 0; i < len; ++i) {
+            std::unique_ptr<ScriptPosition> position = ScriptPosition::Create(*positions->Get(i));
+            if (position == nullptr) {
+                error += "'positions' items ScriptPosition is invalid;";
+                break;
+            }
+            paramsObject->positions_.emplace_back(std::move(position));
+        }
+    } else {
+        error += "Unknown or wrong type of 'positions';";
+    }
+
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "SetBlackboxedRangesParams::Create " << error;
+        return nullptr;
+    }
+
+    return paramsObject;
+}
+
 std::unique_ptr<SetBreakpointByUrlParams> SetBreakpointByUrlParams::Create(const PtJson &params)
 {
     auto paramsObject = std::make_unique<SetBreakpointByUrlParams>();
@@ -398,6 +473,20 @@ std::unique_ptr<SetBreakpointByUrlParams> SetBreakpointByUrlParams::Create(const
     } else if (ret == Result::TYPE_ERROR) {
         error += "Wrong type of 'condition';";
     }
+    std::string logMessage;
+    ret = params.GetString("logMessage", &logMessage);
+    if (ret == Result::SUCCESS) {
+        paramsObject->logMessage_ = std::move(logMessage);
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'logMessage';";
+    }
+    std::string hitCondition;
+    ret = params.GetString("hitCondition", &hitCondition);
+    if (ret == Result::SUCCESS) {
+        paramsObject->hitCondition_ = std::move(hitCondition);
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'hitCondition';";
+    }
     if (!error.empty()) {
         LOG_DEBUGGER(ERROR) << "SetBreakpointByUrlParams::Create " << error;
         return nullptr;
@@ -497,6 +586,50 @@ std::unique_ptr<SetPauseOnExceptionsParams> SetPauseOnExceptionsParams::Create(c
         error += "Unknown or wrong type of'state';";
     }
 
+    std::unique_ptr<PtJson> errorNames;
+    ret = params.GetArray("errorNames", &errorNames);
+    if (ret == Result::SUCCESS) {
+        int32_t len = errorNames->GetSize();
+        for (int32_t i = 0; i < len; ++i) {
+            std::unique_ptr<PtJson> item = errorNames->Get(i);
+            if (item->IsString()) {
+                paramsObject->errorNames_.emplace_back(item->GetString());
+            } else {
+                error += "'errorNames' items should be a String;";
+            }
+        }
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'errorNames';";
+    }
+
+    std::unique_ptr<PtJson> urlPatterns;
+    ret = params.GetArray("urlPatterns", &urlPatterns);
+    if (ret == Result::SUCCESS) {
+        int32_t len = urlPatterns->GetSize();
+        for (int32_t i = 0; i < len; ++i) {
+            std::unique_ptr<PtJson> item = urlPatterns->Get(i);
+            if (item->IsString()) {
+                paramsObject->urlPatterns_.emplace_back(item->GetString());
+            } else {
+                error += "'urlPatterns' items should be a String;";
+            }
+        }
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'urlPatterns';";
+    }
+
+    int32_t throwsPerPause = 0;
+    ret = params.GetInt("throwsPerPause", &throwsPerPause);
+    if (ret == Result::SUCCESS) {
+        if (throwsPerPause > 0) {
+            paramsObject->throwsPerPause_ = static_cast<uint32_t>(throwsPerPause);
+        } else {
+            error += "'throwsPerPause' should be positive;";
+        }
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'throwsPerPause';";
+    }
+
     if (!error.empty()) {
         LOG_DEBUGGER(ERROR) << "SetPauseOnExceptionsParams::Create " << error;
         return nullptr;
@@ -633,6 +766,57 @@ std::unique_ptr<DropFrameParams> DropFrameParams::Create(const PtJson &params)
     return paramsObject;
 }
 
+std::unique_ptr<SetPausedCallFramesLimitParams> SetPausedCallFramesLimitParams::Create(const PtJson &params)
+{
+    auto paramsObject = std::make_unique<SetPausedCallFramesLimitParams>();
+    std::string error;
+    Result ret;
+
+    uint32_t limit = 0;
+    ret = params.GetUInt("limit", &limit);
+    if (ret == Result::SUCCESS) {
+        paramsObject->limit_ = limit;
+    } else {
+        error += "Unknown or wrong type of 'limit';";
+    }
+
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "SetPausedCallFramesLimitParams::Create " << error;
+        return nullptr;
+    }
+
+    return paramsObject;
+}
+
+std::unique_ptr<GetCallFramesParams> GetCallFramesParams::Create(const PtJson &params)
+{
+    auto paramsObject = std::make_unique<GetCallFramesParams>();
+    std::string error;
+    Result ret;
+
+    uint32_t start = 0;
+    ret = params.GetUInt("start", &start);
+    if (ret == Result::SUCCESS) {
+        paramsObject->start_ = start;
+    } else {
+        error += "Unknown or wrong type of 'start';";
+    }
+    uint32_t count = 0;
+    ret = params.GetUInt("count", &count);
+    if (ret == Result::SUCCESS) {
+        paramsObject->count_ = count;
+    } else if (ret == Result::TYPE_ERROR) {
+        error += "Wrong type of 'count';";
+    }
+
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "GetCallFramesParams::Create " << error;
+        return nullptr;
+    }
+
+    return paramsObject;
+}
+
 std::unique_ptr<SetNativeRangeParams> SetNativeRangeParams::Create(const PtJson &params)
 {
     auto paramsObject = std::make_unique<SetNativeRangeParams>();
@@ -801,6 +985,50 @@ std::unique_ptr<GetPropertiesParams> GetPropertiesParams::Create(const PtJson &p
     return paramsObject;
 }
 
+std::unique_ptr<ReleaseObjectParams> ReleaseObjectParams::Create(const PtJson &params)
+{
+    auto paramsObject = std::make_unique<ReleaseObjectParams>();
+    std::string error;
+    Result ret;
+
+    std::string objectId;
+    ret = params.GetString("objectId", &objectId);
+    if (ret == Result::SUCCESS) {
+        if (!ToolchainUtils::StrToInt32(objectId, paramsObject->objectId_)) {
+            error += "Failed to convert 'objectId' from string to int;";
+        }
+    } else {
+        error += "Unknown or wrong type of 'objectId';";
+    }
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "ReleaseObjectParams::Create " << error;
+        return nullptr;
+    }
+
+    return paramsObject;
+}
+
+std::unique_ptr<ReleaseObjectGroupParams> ReleaseObjectGroupParams::Create(const PtJson &params)
+{
+    auto paramsObject = std::make_unique<ReleaseObjectGroupParams>();
+    std::string error;
+    Result ret;
+
+    std::string objectGroup;
+    ret = params.GetString("objectGroup", &objectGroup);
+    if (ret == Result::SUCCESS) {
+        paramsObject->objectGroup_ = std::move(objectGroup);
+    } else {
+        error += "Unknown or wrong type of 'objectGroup';";
+    }
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "ReleaseObjectGroupParams::Create " << error;
+        return nullptr;
+    }
+
+    return paramsObject;
+}
+
 std::unique_ptr<CallFunctionOnParams> CallFunctionOnParams::Create(const PtJson &params)
 {
     auto paramsObject = std::make_unique<CallFunctionOnParams>();
@@ -74,6 +74,17 @@ public:
         return maxScriptsCacheSize_.has_value();
     }
 
+    const std::string &GetBreakpointsCachePath() const
+    {
+        ASSERT(HasBreakpointsCachePath());
+        return breakpointsCachePath_.value();
+    }
+
+    bool HasBreakpointsCachePath() const
+    {
+        return breakpointsCachePath_.has_value();
+    }
+
     bool HasEnableOptionsList() const
     {
         return enableOptionList_.has_value();
@@ -91,6 +102,8 @@ private:
 
     std::optional<double> maxScriptsCacheSize_ {};
     std::optional<std::vector<std::string>> enableOptionList_ {};
+    // the file of the breakpoints cache of launch accelerate mode
+    std::optional<std::string> breakpointsCachePath_ {};
 };
 
 class EvaluateOnCallFrameParams : public PtBaseParams {
@@ -110,6 +123,17 @@ public:
         return expression_;
     }
 
+    const std::string &GetObjectGroup() const
+    {
+        ASSERT(HasObjectGroup());
+        return objectGroup_.value();
+    }
+
+    bool HasObjectGroup() const
+    {
+        return objectGroup_.has_value();
+    }
+
 private:
     NO_COPY_SEMANTIC(EvaluateOnCallFrameParams);
     NO_MOVE_SEMANTIC(EvaluateOnCallFrameParams);
@@ -187,6 +211,25 @@ private:
     ScriptId scriptId_ {0};
 };
 
+class GetStackTraceParams : public PtBaseParams {
+public:
+    GetStackTraceParams() = default;
+    ~GetStackTraceParams() override = default;
+
+    static std::unique_ptr<GetStackTraceParams> Create(const PtJson &params);
+
+    StackTraceId *GetStackTraceId() const
+    {
+        return stackTraceId_.get();
+    }
+
+private:
+    NO_COPY_SEMANTIC(GetStackTraceParams);
+    NO_MOVE_SEMANTIC(GetStackTraceParams);
+
+    std::unique_ptr<StackTraceId> stackTraceId_ {nullptr};
+};
+
 class RemoveBreakpointParams : public PtBaseParams {
 public:
     RemoveBreakpointParams() = default;
@@ -291,6 +334,30 @@ private:
     std::list<std::string> patterns_ {};
 };
 
+class SetBlackboxedRangesParams : public PtBaseParams {
+public:
+    SetBlackboxedRangesParams() = default;
+    ~SetBlackboxedRangesParams() override = default;
+    static std::unique_ptr<SetBlackboxedRangesParams> Create(const PtJson &params);
+
+    ScriptId GetScriptId() const
+    {
+        return scriptId_;
+    }
+
+    const std::vector<std::unique_ptr<ScriptPosition>> *GetPositions() const
+    {
+        return &positions_;
+    }
+
+private:
+    NO_COPY_SEMANTIC(SetBlackboxedRangesParams);
+    NO_MOVE_SEMANTIC(SetBlackboxedRangesParams);
+
+    ScriptId scriptId_ {0};
+    std::vector<std::unique_ptr<ScriptPosition>> positions_ {};
+};
+
 class SetBreakpointByUrlParams : public PtBaseParams {
 public:
     SetBreakpointByUrlParams() = default;
@@ -357,6 +424,28 @@ public:
         return condition_.has_value();
     }
 
+    const std::string &GetLogMessage() const
+    {
+        ASSERT(HasLogMessage());
+        return logMessage_.value();
+    }
+
+    bool HasLogMessage() const
+    {
+        return logMessage_.has_value();
+    }
+
+    const std::string &GetHitCondition() const
+    {
+        ASSERT(HasHitCondition());
+        return hitCondition_.value();
+    }
+
+    bool HasHitCondition() const
+    {
+        return hitCondition_.has_value();
+    }
+
 private:
     NO_COPY_SEMANTIC(SetBreakpointByUrlParams);
     NO_MOVE_SEMANTIC(SetBreakpointByUrlParams);
@@ -367,6 +456,8 @@ private:
     std::optional<std::string> scriptHash_ {};
     std::optional<int32_t> columnNumber_ {0};
     std::optional<std::string> condition_ {};
+    std::optional<std::string> logMessage_ {};
+    std::optional<std::string> hitCondition_ {};
 };
 
 
@@ -462,11 +553,31 @@ public:
         return false;
     }
 
+    const std::vector<std::string> &GetErrorNames() const
+    {
+        return errorNames_;
+    }
+
+    const std::vector<std::string> &GetUrlPatterns() const
+    {
+        return urlPatterns_;
+    }
+
+    uint32_t GetThrowsPerPause() const
+    {
+        return throwsPerPause_;
+    }
+
 private:
     NO_COPY_SEMANTIC(SetPauseOnExceptionsParams);
     NO_MOVE_SEMANTIC(SetPauseOnExceptionsParams);
 
     PauseOnExceptionsState state_ {PauseOnExceptionsState::ALL};
+    // Extended filters of the exception pauses: the constructor names of the exceptions, the url
+    // patterns of the throwing scripts, and the throws of a site per pause
+    std::vector<std::string> errorNames_ {};
+    std::vector<std::string> urlPatterns_ {};
+    uint32_t throwsPerPause_ {1};
 };
 
 class StepIntoParams : public PtBaseParams {
@@ -578,6 +689,53 @@ private:
     std::optional<uint32_t> droppedDepth_ {};
 };
 
+class SetPausedCallFramesLimitParams : public PtBaseParams {
+public:
+    SetPausedCallFramesLimitParams() = default;
+    ~SetPausedCallFramesLimitParams() override = default;
+    static std::unique_ptr<SetPausedCallFramesLimitParams> Create(const PtJson &params);
+
+    uint32_t GetLimit() const
+    {
+        return limit_;
+    }
+
+private:
+    NO_COPY_SEMANTIC(SetPausedCallFramesLimitParams);
+    NO_MOVE_SEMANTIC(SetPausedCallFramesLimitParams);
+
+    uint32_t limit_ {0};
+};
+
+class GetCallFramesParams : public PtBaseParams {
+public:
+    GetCallFramesParams() = default;
+    ~GetCallFramesParams() override = default;
+    static std::unique_ptr<GetCallFramesParams> Create(const PtJson &params);
+
+    uint32_t GetStart() const
+    {
+        return start_;
+    }
+
+    uint32_t GetCount() const
+    {
+        return count_.value_or(0);
+    }
+
+    bool HasCount() const
+    {
+        return count_.has_value();
+    }
+
+private:
+    NO_COPY_SEMANTIC(GetCallFramesParams);
+    NO_MOVE_SEMANTIC(GetCallFramesParams);
+
+    uint32_t start_ {0};
+    std::optional<uint32_t> count_ {};
+};
+
 class SetNativeRangeParams {
 public:
     SetNativeRangeParams() = default;
@@ -754,6 +912,44 @@ private:
     static constexpr int32_t INVALID_START_OR_COUNT = -1;
 };
 
+class ReleaseObjectParams : public PtBaseParams {
+public:
+    ReleaseObjectParams() = default;
+    ~ReleaseObjectParams() override = default;
+
+    static std::unique_ptr<ReleaseObjectParams> Create(const PtJson &params);
+
+    RemoteObjectId GetObjectId() const
+    {
+        return objectId_;
+    }
+
+private:
+    NO_COPY_SEMANTIC(ReleaseObjectParams);
+    NO_MOVE_SEMANTIC(ReleaseObjectParams);
+
+    RemoteObjectId objectId_ {};
+};
+
+class ReleaseObjectGroupParams : public PtBaseParams {
+public:
+    ReleaseObjectGroupParams() = default;
+    ~ReleaseObjectGroupParams() override = default;
+
+    static std::unique_ptr<ReleaseObjectGroupParams> Create(const PtJson &params);
+
+    const std::string &GetObjectGroup() const
+    {
+        return objectGroup_;
+    }
+
+private:
+    NO_COPY_SEMANTIC(ReleaseObjectGroupParams);
+    NO_MOVE_SEMANTIC(ReleaseObjectGroupParams);
+
+    std::string objectGroup_ {};
+};
+
 class CallFunctionOnParams : public PtBaseParams {
 public:
     CallFunctionOnParams() = default;
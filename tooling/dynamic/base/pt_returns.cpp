@@ -119,6 +119,16 @@ std::unique_ptr<PtJson> GetScriptSourceReturns::ToJson() const
     return result;
 }
 
+std::unique_ptr<PtJson> GetStackTraceReturns::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    ASSERT(stackTrace_ != nullptr);
+    result->Add("stackTrace", stackTrace_->ToJson());
+
+    return result;
+}
+
 std::unique_ptr<PtJson> RestartFrameReturns::ToJson() const
 {
     std::unique_ptr<PtJson> result = PtJson::CreateObject();
@@ -135,6 +145,22 @@ std::unique_ptr<PtJson> RestartFrameReturns::ToJson() const
     return result;
 }
 
+std::unique_ptr<PtJson> GetCallFramesReturns::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    std::unique_ptr<PtJson> array = PtJson::CreateArray();
+    size_t len = callFrames_.size();
+    for (size_t i = 0; i < len; i++) {
+        ASSERT(callFrames_[i] != nullptr);
+        array->Push(callFrames_[i]->ToJson());
+    }
+    result->Add("callFrames", array);
+    result->Add("hasMore", hasMore_);
+
+    return result;
+}
+
 std::unique_ptr<PtJson> SearchInContentReturns::ToJson() const
 {
     std::unique_ptr<PtJson> result = PtJson::CreateObject();
@@ -232,6 +258,9 @@ std::unique_ptr<PtJson> GetPropertiesReturns::ToJson() const
         ASSERT(exceptionDetails_.value() != nullptr);
         result->Add("exceptionDetails", exceptionDetails_.value()->ToJson());
     }
+    if (hasMore_) {
+        result->Add("hasMore", hasMore_.value());
+    }
 
     return result;
 }
@@ -422,4 +451,34 @@ std::unique_ptr<PtJson> GetNavigationHistoryReturns::ToJson() const
 
     return result;
 }
+
+std::unique_ptr<PtJson> GetProtocolMetricsReturns::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    std::unique_ptr<PtJson> metrics = PtJson::CreateArray();
+    for (const auto &[method, methodMetrics] : metrics_) {
+        std::unique_ptr<PtJson> item = PtJson::CreateObject();
+        item->Add("method", method.c_str());
+        item->Add("callCount", static_cast<int64_t>(methodMetrics.callCount));
+        item->Add("totalTime", static_cast<int64_t>(methodMetrics.totalTime));
+        item->Add("maxTime", static_cast<int64_t>(methodMetrics.maxTime));
+        item->Add("bytesIn", static_cast<int64_t>(methodMetrics.bytesIn));
+        item->Add("bytesOut", static_cast<int64_t>(methodMetrics.bytesOut));
+        metrics->Push(item);
+    }
+    result->Add("metrics", metrics);
+
+    std::unique_ptr<PtJson> events = PtJson::CreateArray();
+    for (const auto &[event, eventMetrics] : events_) {
+        std::unique_ptr<PtJson> item = PtJson::CreateObject();
+        item->Add("event", event.c_str());
+        item->Add("count", static_cast<int64_t>(eventMetrics.callCount));
+        item->Add("bytesOut", static_cast<int64_t>(eventMetrics.bytesOut));
+        events->Push(item);
+    }
+    result->Add("events", events);
+
+    return result;
+}
 }  // namespace panda::ecmascript::tooling
\ No newline at end of file
@@ -16,6 +16,7 @@
 #ifndef ECMASCRIPT_TOOLING_BASE_PT_RETURNS_H
 #define ECMASCRIPT_TOOLING_BASE_PT_RETURNS_H
 
+#include "tooling/dynamic/base/pt_metrics.h"
 #include "tooling/dynamic/base/pt_types.h"
 
 namespace panda::ecmascript::tooling {
@@ -153,6 +154,21 @@ private:
     std::optional<std::string> bytecode_ {};
 };
 
+class GetStackTraceReturns : public PtBaseReturns {
+public:
+    explicit GetStackTraceReturns(std::unique_ptr<StackTrace> stackTrace) : stackTrace_(std::move(stackTrace)) {}
+    ~GetStackTraceReturns() override = default;
+
+    std::unique_ptr<PtJson> ToJson() const override;
+
+private:
+    GetStackTraceReturns() = default;
+    NO_COPY_SEMANTIC(GetStackTraceReturns);
+    NO_MOVE_SEMANTIC(GetStackTraceReturns);
+
+    std::unique_ptr<StackTrace> stackTrace_ {};
+};
+
 class RestartFrameReturns : public PtBaseReturns {
 public:
     explicit RestartFrameReturns(std::vector<std::unique_ptr<CallFrame>> callFrames)
@@ -169,6 +185,23 @@ private:
     std::vector<std::unique_ptr<CallFrame>> callFrames_ {};
 };
 
+class GetCallFramesReturns : public PtBaseReturns {
+public:
+    GetCallFramesReturns(std::vector<std::unique_ptr<CallFrame>> callFrames, bool hasMore)
+        : callFrames_(std::move(callFrames)), hasMore_(hasMore)
+    {}
+    ~GetCallFramesReturns() override = default;
+    std::unique_ptr<PtJson> ToJson() const override;
+
+private:
+    GetCallFramesReturns() = default;
+    NO_COPY_SEMANTIC(GetCallFramesReturns);
+    NO_MOVE_SEMANTIC(GetCallFramesReturns);
+
+    std::vector<std::unique_ptr<CallFrame>> callFrames_ {};
+    bool hasMore_ {false};
+};
+
 class SearchInContentReturns : public PtBaseReturns {
 public:
     explicit SearchInContentReturns(std::vector<std::unique_ptr<SearchMatch>> result) : result_(std::move(result))
@@ -242,11 +275,13 @@ public:
     explicit GetPropertiesReturns(std::vector<std::unique_ptr<PropertyDescriptor>> descriptor,
         std::optional<std::vector<std::unique_ptr<InternalPropertyDescriptor>>> internalDescripties = std::nullopt,
         std::optional<std::vector<std::unique_ptr<PrivatePropertyDescriptor>>> privateProperties = std::nullopt,
-        std::optional<std::unique_ptr<ExceptionDetails>> exceptionDetails = std::nullopt)
+        std::optional<std::unique_ptr<ExceptionDetails>> exceptionDetails = std::nullopt,
+        std::optional<bool> hasMore = std::nullopt)
         : result_(std::move(descriptor)),
           internalPropertyDescripties_(std::move(internalDescripties)),
           privateProperties_(std::move(privateProperties)),
-          exceptionDetails_(std::move(exceptionDetails))
+          exceptionDetails_(std::move(exceptionDetails)),
+          hasMore_(hasMore)
     {}
     ~GetPropertiesReturns() override = default;
     std::unique_ptr<PtJson> ToJson() const override;
@@ -260,6 +295,8 @@ private:
     std::optional<std::vector<std::unique_ptr<InternalPropertyDescriptor>>> internalPropertyDescripties_ {};
     std::optional<std::vector<std::unique_ptr<PrivatePropertyDescriptor>>> privateProperties_ {};
     std::optional<std::unique_ptr<ExceptionDetails>> exceptionDetails_ {};
+    // set for a request with 'start' and 'count', whether the properties go on after the page
+    std::optional<bool> hasMore_ {};
 };
 
 class CallFunctionOnReturns : public PtBaseReturns {
@@ -490,5 +527,22 @@ private:
     NO_COPY_SEMANTIC(GetNavigationHistoryReturns);
     NO_MOVE_SEMANTIC(GetNavigationHistoryReturns);
 };
+
+class GetProtocolMetricsReturns : public PtBaseReturns {
+public:
+    GetProtocolMetricsReturns(std::map<std::string, MethodMetrics> metrics,
+        std::map<std::string, MethodMetrics> events)
+        : metrics_(std::move(metrics)), events_(std::move(events)) {}
+    ~GetProtocolMetricsReturns() override = default;
+    std::unique_ptr<PtJson> ToJson() const override;
+
+private:
+    GetProtocolMetricsReturns() = default;
+    NO_COPY_SEMANTIC(GetProtocolMetricsReturns);
+    NO_MOVE_SEMANTIC(GetProtocolMetricsReturns);
+
+    std::map<std::string, MethodMetrics> metrics_ {};
+    std::map<std::string, MethodMetrics> events_ {};
+};
 }  // namespace panda::ecmascript::tooling
 #endif
\ No newline at end of file
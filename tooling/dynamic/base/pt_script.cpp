@@ -24,4 +24,50 @@ PtScript::PtScript(ScriptId scriptId, const std::string &fileName, const std::st
 {
     endLine_ = std::count(scriptSource_.begin(), scriptSource_.end(), '\n');
 }
+
+PtScript::PtScript(ScriptId scriptId, const std::string &fileName, const std::string &url, int32_t endLine,
+    SourceLoader sourceLoader)
+    : scriptId_(scriptId),
+      fileName_(fileName),
+      url_(url),
+      sourceLoader_(std::move(sourceLoader)),
+      endLine_(endLine)
+{
+}
+
+const std::string *PtScriptSourceCache::Find(ScriptId scriptId)
+{
+    auto iter = index_.find(scriptId);
+    if (iter == index_.end()) {
+        return nullptr;
+    }
+    sources_.splice(sources_.begin(), sources_, iter->second);
+    return &iter->second->second;
+}
+
+void PtScriptSourceCache::Insert(ScriptId scriptId, const std::string &source)
+{
+    if (capacity_ == 0 || source.size() > capacity_ || index_.find(scriptId) != index_.end()) {
+        return;
+    }
+    sources_.emplace_front(scriptId, source);
+    index_.emplace(scriptId, sources_.begin());
+    size_ += source.size();
+    Evict();
+}
+
+void PtScriptSourceCache::SetCapacity(size_t capacity)
+{
+    capacity_ = capacity;
+    Evict();
+}
+
+void PtScriptSourceCache::Evict()
+{
+    while (size_ > capacity_) {
+        size_ -= sources_.back().second.size();
+        index_.erase(sources_.back().first);
+        sources_.pop_back();
+    }
+}
 }  // namespace panda::ecmascript::tooling
\ No newline at end of file
@@ -16,6 +16,9 @@
 #ifndef ECMASCRIPT_TOOLING_BASE_PT_SCRIPT_H
 #define ECMASCRIPT_TOOLING_BASE_PT_SCRIPT_H
 
+#include <functional>
+#include <list>
+
 #include "tooling/dynamic/base/pt_types.h"
 
 #include "libpandabase/macros.h"
@@ -29,7 +32,12 @@ enum class ScriptMatchType : uint8_t {
 
 class PtScript {
 public:
+    // Loads the source of a script from its binary file, so the script does not hold a copy of it
+    using SourceLoader = std::function<std::string(const std::string &fileName)>;
+
     PtScript(ScriptId scriptId, const std::string &fileName, const std::string &url, const std::string &source);
+    PtScript(ScriptId scriptId, const std::string &fileName, const std::string &url, int32_t endLine,
+        SourceLoader sourceLoader);
     ~PtScript() = default;
 
     ScriptId GetScriptId() const
@@ -72,14 +80,23 @@ public:
         hash_ = hash;
     }
 
-    const std::string &GetScriptSource() const
+    std::string GetScriptSource() const
     {
+        if (sourceLoader_) {
+            return sourceLoader_(fileName_);
+        }
         return scriptSource_;
     }
 
     void SetScriptSource(const std::string &scriptSource)
     {
         scriptSource_ = scriptSource;
+        sourceLoader_ = nullptr;
+    }
+
+    bool HasSourceLoader() const
+    {
+        return static_cast<bool>(sourceLoader_);
     }
 
     const std::string &GetSourceMapUrl() const
@@ -112,6 +129,26 @@ public:
         locations_ = locations;
     }
 
+    bool IsBlackboxed() const
+    {
+        return blackboxed_;
+    }
+
+    void SetBlackboxed(bool blackboxed)
+    {
+        blackboxed_ = blackboxed;
+    }
+
+    const std::vector<std::pair<int32_t, int32_t>> &GetBlackboxedRanges() const
+    {
+        return blackboxedRanges_;
+    }
+
+    void SetBlackboxedRanges(std::vector<std::pair<int32_t, int32_t>> blackboxedRanges)
+    {
+        blackboxedRanges_ = std::move(blackboxedRanges);
+    }
+
 private:
     NO_COPY_SEMANTIC(PtScript);
     NO_MOVE_SEMANTIC(PtScript);
@@ -121,9 +158,48 @@ private:
     std::string url_ {};           // source file name, such as xx.js
     std::string hash_ {};          // js source file hash code
     std::string scriptSource_ {};  // js source code
+    SourceLoader sourceLoader_ {};  // loads the js source code instead, if set
     std::string sourceMapUrl_ {};  // source map url
     int32_t endLine_ {0};      // total line number of source file
     std::vector<std::shared_ptr<BreakpointReturnInfo>> locations_ {};
+    bool blackboxed_ {false};      // the url matches a pattern of Debugger.setBlackboxPatterns
+    // sorted {line, column} of Debugger.setBlackboxedRanges, a range starts at each even index
+    // and ends before the next position
+    std::vector<std::pair<int32_t, int32_t>> blackboxedRanges_ {};
+};
+
+// The sources of the scripts recently loaded by their SourceLoader. The least recently used ones are
+// evicted once the sources take more than the capacity in bytes, and a capacity of 0 caches nothing
+class PtScriptSourceCache {
+public:
+    PtScriptSourceCache() = default;
+    ~PtScriptSourceCache() = default;
+
+    const std::string *Find(ScriptId scriptId);
+    void Insert(ScriptId scriptId, const std::string &source);
+    void SetCapacity(size_t capacity);
+
+    size_t GetCapacity() const
+    {
+        return capacity_;
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    NO_COPY_SEMANTIC(PtScriptSourceCache);
+    NO_MOVE_SEMANTIC(PtScriptSourceCache);
+
+    void Evict();
+
+    size_t capacity_ {0};
+    size_t size_ {0};
+    // the most recently used source at the front
+    std::list<std::pair<ScriptId, std::string>> sources_ {};
+    std::unordered_map<ScriptId, std::list<std::pair<ScriptId, std::string>>::iterator> index_ {};
 };
 }  // namespace panda::ecmascript::tooling
 #endif
@@ -259,6 +259,19 @@ void RemoteObject::AppendingSendableDescription(Local<JSValueRef> tagged, std::s
     }
 }
 
+std::string RemoteObject::AbbreviateDescription(const std::string &description, size_t maxLength)
+{
+    if (description.size() <= maxLength) {
+        return description;
+    }
+    // cut at the start of a utf-8 character, never in the middle of one
+    size_t length = maxLength;
+    while (length > 0 && (static_cast<uint8_t>(description[length]) & 0xC0) == 0x80) {  // 0xC0, 0x80: continuation
+        length--;
+    }
+    return description.substr(0, length) + "...";
+}
+
 std::string RemoteObject::ResolveClassNameToDescription(const EcmaVM *ecmaVm, Local<JSValueRef> tagged)
 {
     std::string description = RemoteObject::ObjectDescription;
@@ -279,7 +292,6 @@ PrimitiveRemoteObject::PrimitiveRemoteObject(const EcmaVM *ecmaVm, Local<JSValue
         std::string description = tagged->IsTrue() ? "true" : "false";
         SetType(ObjectType::Boolean)
             .SetValue(tagged)
-            .SetPreviewValue(description)
             .SetUnserializableValue(description)
             .SetDescription(description);
     } else if (tagged->IsUndefined()) {
@@ -288,14 +300,12 @@ PrimitiveRemoteObject::PrimitiveRemoteObject(const EcmaVM *ecmaVm, Local<JSValue
         std::string description = tagged->ToString(ecmaVm)->ToString(ecmaVm);
         SetType(ObjectType::Number)
             .SetValue(tagged)
-            .SetPreviewValue(description)
             .SetUnserializableValue(description)
             .SetDescription(description);
     } else if (tagged->IsBigInt(ecmaVm)) {
         std::string description = tagged->ToString(ecmaVm)->ToString(ecmaVm) + "n";  // n : BigInt literal postfix
         SetType(ObjectType::Bigint)
             .SetValue(tagged)
-            .SetPreviewValue(description)
             .SetUnserializableValue(description)
             .SetDescription(description);
     }
@@ -303,18 +313,17 @@ PrimitiveRemoteObject::PrimitiveRemoteObject(const EcmaVM *ecmaVm, Local<JSValue
 
 StringRemoteObject::StringRemoteObject([[maybe_unused]] const EcmaVM *ecmaVm, Local<StringRef> tagged)
 {
-    std::string description = tagged->DebuggerToString(ecmaVm);
+    // the value is the whole string, only its description is cut off, from the one conversion of the string
+    std::string value = tagged->DebuggerToString(ecmaVm);
     SetType(RemoteObject::TypeName::String)
         .SetValue(tagged)
-        .SetPreviewValue(description)
-        .SetUnserializableValue(description)
-        .SetDescription(description);
+        .SetDescription(AbbreviateDescription(value, MAX_DESCRIPTION_LENGTH))
+        .SetUnserializableValue(std::move(value));
 }
 
 SymbolRemoteObject::SymbolRemoteObject(const EcmaVM *ecmaVm, Local<SymbolRef> tagged)
 {
-    std::string description = DescriptionForSymbol(ecmaVm, tagged);
-    SetPreviewValue(description);
+    std::string description = AbbreviateDescription(DescriptionForSymbol(ecmaVm, tagged), MAX_DESCRIPTION_LENGTH);
     AppendingHashToDescription(ecmaVm, tagged, description);
     AppendingSendableDescription(tagged, description);
     SetType(RemoteObject::TypeName::Symbol)
@@ -331,7 +340,6 @@ FunctionRemoteObject::FunctionRemoteObject(const EcmaVM *ecmaVm, Local<JSValueRe
     SetType(RemoteObject::TypeName::Function)
         .SetClassName(RemoteObject::ClassName::Function)
         .SetValue(tagged)
-        .SetPreviewValue(RemoteObject::ClassName::Function)
         .SetUnserializableValue(description)
         .SetDescription(description);
 }
@@ -344,7 +352,6 @@ GeneratorFunctionRemoteObject::GeneratorFunctionRemoteObject(const EcmaVM *ecmaV
     SetType(RemoteObject::TypeName::Function)
         .SetClassName(RemoteObject::ClassName::Generator)
         .SetValue(tagged)
-        .SetPreviewValue(RemoteObject::ClassName::Generator)
         .SetUnserializableValue(description)
         .SetDescription(description);
 }
@@ -353,8 +360,8 @@ ObjectRemoteObject::ObjectRemoteObject(const EcmaVM *ecmaVm, Local<JSValueRef> t
                                        const std::string &classname)
 {
     std::string arrayOrContainer;
-    std::string description = DescriptionForObject(ecmaVm, tagged, arrayOrContainer);
-    SetPreviewValue(description);
+    std::string description = AbbreviateDescription(DescriptionForObject(ecmaVm, tagged, arrayOrContainer),
+        MAX_DESCRIPTION_LENGTH);
     AppendingHashToDescription(ecmaVm, tagged, description);
     AppendingSendableDescription(tagged, description);
     SetType(RemoteObject::TypeName::Object)
@@ -369,8 +376,8 @@ ObjectRemoteObject::ObjectRemoteObject(const EcmaVM *ecmaVm, Local<JSValueRef> t
                                        const std::string &classname, const std::string &subtype)
 {
     std::string arrayOrContainer;
-    std::string description = DescriptionForObject(ecmaVm, tagged, arrayOrContainer);
-    SetPreviewValue(description);
+    std::string description = AbbreviateDescription(DescriptionForObject(ecmaVm, tagged, arrayOrContainer),
+        MAX_DESCRIPTION_LENGTH);
     AppendingHashToDescription(ecmaVm, tagged, description);
     AppendingSendableDescription(tagged, description);
     SetType(RemoteObject::TypeName::Object)
@@ -623,7 +630,6 @@ std::string ObjectRemoteObject::DescriptionForMap(const EcmaVM *ecmaVm, Local<Ma
         return description;
     }
     description += " {";
-    char cPre = '\'';
     for (int32_t i = 0; i < len; ++i) {
         // add Key
         Local<JSValueRef> jsVKey = tagged->GetKey(ecmaVm, i);
@@ -632,23 +638,11 @@ std::string ObjectRemoteObject::DescriptionForMap(const EcmaVM *ecmaVm, Local<Ma
         }
 
         Local<JSValueRef> jsVValue = tagged->GetValue(ecmaVm, i);
-        if (jsVKey->IsObject(ecmaVm)) {
-            description += "Object";
-        } else if (jsVKey->IsString(ecmaVm)) {
-            description += cPre + jsVKey->ToString(ecmaVm)->DebuggerToString(ecmaVm) + cPre;
-        } else {
-            description += jsVKey->ToString(ecmaVm)->DebuggerToString(ecmaVm);
-        }
+        description += DescriptionForEntry(ecmaVm, jsVKey);
 
         description += " => ";
         // add Value
-        if (jsVValue->IsObject(ecmaVm)) {
-            description += "Object";
-        } else if (jsVValue->IsString(ecmaVm)) {
-            description += cPre + jsVValue->ToString(ecmaVm)->DebuggerToString(ecmaVm) + cPre;
-        } else {
-            description += jsVValue->ToString(ecmaVm)->DebuggerToString(ecmaVm);
-        }
+        description += DescriptionForEntry(ecmaVm, jsVValue);
         if (index == tagged->GetSize(ecmaVm) - 1 || index >= 4) { // 4:The count of elements
             description += tagged->GetSize(ecmaVm) > 5 ? ", ..." : ""; // 5:The count of elements
             break;
@@ -669,30 +663,17 @@ std::string ObjectRemoteObject::DescriptionForWeakMap(const EcmaVM *ecmaVm, Loca
         return description;
     }
     description += " {";
-    char cPre = '\'';
     for (int32_t i = 0; i < len; ++i) {
         Local<JSValueRef> jsVKey = tagged->GetKey(ecmaVm, i);
         if (jsVKey->IsHole()) {
             continue;
         }
         Local<JSValueRef> jsVValue = tagged->GetValue(ecmaVm, i);
-        if (jsVKey->IsObject(ecmaVm)) {
-            description += "Object";
-        } else if (jsVKey->IsString(ecmaVm)) {
-            description += cPre + jsVKey->ToString(ecmaVm)->DebuggerToString(ecmaVm) + cPre;
-        } else {
-            description += jsVKey->ToString(ecmaVm)->DebuggerToString(ecmaVm);
-        }
+        description += DescriptionForEntry(ecmaVm, jsVKey);
 
         description += " => ";
 
-        if (jsVValue->IsObject(ecmaVm)) {
-            description += "Object";
-        } else if (jsVValue->IsString(ecmaVm)) {
-            description += cPre + jsVValue->ToString(ecmaVm)->DebuggerToString(ecmaVm) + cPre;
-        } else {
-            description += jsVValue->ToString(ecmaVm)->DebuggerToString(ecmaVm);
-        }
+        description += DescriptionForEntry(ecmaVm, jsVValue);
         if (index == tagged->GetSize(ecmaVm) - 1 || index >= 4) { // 4:The count of elements
             description += tagged->GetSize(ecmaVm) > 5 ? ", ..." : ""; // 5:The count of elements
             break;
@@ -713,7 +694,6 @@ std::string ObjectRemoteObject::DescriptionForSet(const EcmaVM *ecmaVm, Local<Se
         return description;
     }
     description += " {";
-    char cPre = '\'';
     for (int32_t i = 0; i < len; ++i) {
         // add Key
         Local<JSValueRef> jsValue = tagged->GetValue(ecmaVm, i);
@@ -721,13 +701,7 @@ std::string ObjectRemoteObject::DescriptionForSet(const EcmaVM *ecmaVm, Local<Se
             continue;
         }
         // add Value
-        if (jsValue->IsObject(ecmaVm)) {
-            description += "Object";
-        } else if (jsValue->IsString(ecmaVm)) {
-            description += cPre + jsValue->ToString(ecmaVm)->DebuggerToString(ecmaVm) + cPre;
-        } else {
-            description += jsValue->ToString(ecmaVm)->DebuggerToString(ecmaVm);
-        }
+        description += DescriptionForEntry(ecmaVm, jsValue);
         if (index == tagged->GetSize(ecmaVm) - 1 || index >= 4) { // 4:The count of elements
             description += tagged->GetSize(ecmaVm) > 5 ? ", ..." : ""; // 5:The count of elements
             break;
@@ -748,19 +722,12 @@ std::string ObjectRemoteObject::DescriptionForWeakSet(const EcmaVM *ecmaVm, Loca
         return description;
     }
     description += " {";
-    char cPre = '\'';
     for (int32_t i = 0; i < len; ++i) {
         Local<JSValueRef> jsValue = tagged->GetValue(ecmaVm, i);
         if (jsValue->IsHole()) {
             continue;
         }
-        if (jsValue->IsObject(ecmaVm)) {
-            description += "Object";
-        } else if (jsValue->IsString(ecmaVm)) {
-            description += cPre + jsValue->ToString(ecmaVm)->DebuggerToString(ecmaVm) + cPre;
-        } else {
-            description += jsValue->ToString(ecmaVm)->DebuggerToString(ecmaVm);
-        }
+        description += DescriptionForEntry(ecmaVm, jsValue);
         if (index == tagged->GetSize(ecmaVm) - 1 || index >= 4) { // 4:The count of elements
             description += tagged->GetSize(ecmaVm) > 5 ? ", ..." : ""; // 5:The count of elements
             break;
@@ -772,6 +739,21 @@ std::string ObjectRemoteObject::DescriptionForWeakSet(const EcmaVM *ecmaVm, Loca
     return description;
 }
 
+std::string ObjectRemoteObject::DescriptionForEntry(const EcmaVM *ecmaVm, Local<JSValueRef> entry)
+{
+    // a nested object is not described, so the description of a container never recurses
+    if (entry->IsObject(ecmaVm)) {
+        return "Object";
+    }
+    std::string description =
+        AbbreviateDescription(entry->ToString(ecmaVm)->DebuggerToString(ecmaVm), MAX_ENTRY_DESCRIPTION_LENGTH);
+    if (entry->IsString(ecmaVm)) {
+        char cPre = '\'';
+        return cPre + description + cPre;
+    }
+    return description;
+}
+
 std::string ObjectRemoteObject::DescriptionForDataView(Local<DataViewRef> tagged)
 {
     std::string description = ("DataView(" + std::to_string(tagged->ByteLength()) + ")");
@@ -1680,6 +1662,73 @@ std::unique_ptr<PtJson> CallArgument::ToJson() const
     return result;
 }
 
+std::unique_ptr<StackTraceId> StackTraceId::Create(const PtJson &params)
+{
+    auto stackTraceId = std::make_unique<StackTraceId>();
+    std::string error;
+    Result ret;
+
+    std::string id;
+    ret = params.GetString("id", &id);
+    if (ret == Result::SUCCESS) {
+        stackTraceId->id_ = std::move(id);
+    } else {
+        error += "Unknown or wrong type of 'id';";
+    }
+    std::string debuggerId;
+    ret = params.GetString("debuggerId", &debuggerId);
+    if (ret == Result::SUCCESS) {
+        stackTraceId->debuggerId_ = std::move(debuggerId);
+    } else if (ret == Result::TYPE_ERROR) {  // optional value
+        error += "Wrong type of 'debuggerId';";
+    }
+
+    if (!error.empty()) {
+        LOG_DEBUGGER(ERROR) << "StackTraceId::Create " << error;
+        return nullptr;
+    }
+
+    return stackTraceId;
+}
+
+std::unique_ptr<PtJson> StackTraceId::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    result->Add("id", id_.c_str());
+    if (debuggerId_) {
+        result->Add("debuggerId", debuggerId_->c_str());
+    }
+
+    return result;
+}
+
+std::unique_ptr<PtJson> StackTrace::ToJson() const
+{
+    std::unique_ptr<PtJson> result = PtJson::CreateObject();
+
+    result->Add("description", description_.c_str());
+    std::unique_ptr<PtJson> array = PtJson::CreateArray();
+    size_t len = callFrames_.size();
+    for (size_t i = 0; i < len; i++) {
+        ASSERT(callFrames_[i] != nullptr);
+        std::unique_ptr<PtJson> callFrame = PtJson::CreateObject();
+        callFrame->Add("functionName", callFrames_[i]->GetFunctionName().c_str());
+        callFrame->Add("scriptId", callFrames_[i]->GetScriptId());
+        callFrame->Add("url", callFrames_[i]->GetUrl().c_str());
+        callFrame->Add("lineNumber", callFrames_[i]->GetLineNumber());
+        callFrame->Add("columnNumber", callFrames_[i]->GetColumnNumber());
+        array->Push(callFrame);
+    }
+    result->Add("callFrames", array);
+    if (parentId_) {
+        ASSERT(parentId_.value() != nullptr);
+        result->Add("parentId", parentId_.value()->ToJson());
+    }
+
+    return result;
+}
+
 std::unique_ptr<Location> Location::Create(const PtJson &params)
 {
     auto location = std::make_unique<Location>();
@@ -276,6 +276,7 @@ public:
         std::string &description);
     static void AppendingSendableDescription(Local<JSValueRef> tagged, std::string &description);
     static std::string ResolveClassNameToDescription(const EcmaVM *ecmaVM, Local<JSValueRef> tagged);
+    static std::string AbbreviateDescription(const std::string &description, size_t maxLength);
     /*
      * @see {#ObjectType}
      */
@@ -354,6 +355,12 @@ public:
         return *this;
     }
 
+    RemoteObject &SetUnserializableValue(UnserializableValue &&unserializableValue)
+    {
+        unserializableValue_ = std::move(unserializableValue);
+        return *this;
+    }
+
     bool HasUnserializableValue() const
     {
         return unserializableValue_.has_value();
@@ -533,6 +540,10 @@ public:
     static const std::string JSRelativeTimeFormatDescription;  // NOLINT (readability-identifier-naming)
     static const std::string ArrayMarker;                      // NOLINT (readability-identifier-naming)
     static const std::string ContainerMarker;                  // NOLINT (readability-identifier-naming)
+    // 10000: bytes of a description or a string value, a longer one is cut off
+    static constexpr size_t MAX_DESCRIPTION_LENGTH = 10000;
+    // 100: bytes of each key or value listed in the description of a container
+    static constexpr size_t MAX_ENTRY_DESCRIPTION_LENGTH = 100;
 
 private:
     NO_COPY_SEMANTIC(RemoteObject);
@@ -606,6 +617,7 @@ private:
     static std::string DescriptionForWeakMap(const EcmaVM *ecmaVm, Local<WeakMapRef> tagged);
     static std::string DescriptionForSet(const EcmaVM *ecmaVm, Local<SetRef> tagged);
     static std::string DescriptionForWeakSet(const EcmaVM *ecmaVm, Local<WeakSetRef> tagged);
+    static std::string DescriptionForEntry(const EcmaVM *ecmaVm, Local<JSValueRef> entry);
     static std::string DescriptionForDataView(Local<DataViewRef> tagged);
     static std::string DescriptionForError(const EcmaVM *ecmaVm, Local<JSValueRef> tagged);
     static std::string DescriptionForArrayIterator();
@@ -1175,6 +1187,109 @@ private:
     std::optional<RemoteObjectId> objectId_ {};
 };
 
+// Runtime.StackTraceId
+class StackTraceId final : public PtBaseTypes {
+public:
+    StackTraceId() = default;
+    ~StackTraceId() override = default;
+
+    static std::unique_ptr<StackTraceId> Create(const PtJson &params);
+    std::unique_ptr<PtJson> ToJson() const override;
+
+    const std::string &GetId() const
+    {
+        return id_;
+    }
+
+    StackTraceId &SetId(const std::string &id)
+    {
+        id_ = id;
+        return *this;
+    }
+
+    const std::string &GetDebuggerId() const
+    {
+        ASSERT(HasDebuggerId());
+        return debuggerId_.value();
+    }
+
+    StackTraceId &SetDebuggerId(const std::string &debuggerId)
+    {
+        debuggerId_ = debuggerId;
+        return *this;
+    }
+
+    bool HasDebuggerId() const
+    {
+        return debuggerId_.has_value();
+    }
+
+private:
+    NO_COPY_SEMANTIC(StackTraceId);
+    NO_MOVE_SEMANTIC(StackTraceId);
+
+    std::string id_ {};
+    std::optional<std::string> debuggerId_ {};
+};
+
+// Runtime.StackTrace, a segment of an async stack whose parent is referred to by its StackTraceId
+class StackTrace final : public PtBaseTypes {
+public:
+    StackTrace() = default;
+    ~StackTrace() override = default;
+
+    std::unique_ptr<PtJson> ToJson() const override;
+
+    const std::string &GetDescription() const
+    {
+        return description_;
+    }
+
+    StackTrace &SetDescription(const std::string &description)
+    {
+        description_ = description;
+        return *this;
+    }
+
+    const std::vector<std::shared_ptr<StackFrame>> *GetCallFrames() const
+    {
+        return &callFrames_;
+    }
+
+    StackTrace &SetCallFrames(std::vector<std::shared_ptr<StackFrame>> callFrames)
+    {
+        callFrames_ = std::move(callFrames);
+        return *this;
+    }
+
+    StackTraceId *GetParentId() const
+    {
+        if (parentId_) {
+            return parentId_->get();
+        }
+        return nullptr;
+    }
+
+    StackTrace &SetParentId(std::unique_ptr<StackTraceId> parentId)
+    {
+        parentId_ = std::move(parentId);
+        return *this;
+    }
+
+    bool HasParentId() const
+    {
+        return parentId_.has_value();
+    }
+
+private:
+    NO_COPY_SEMANTIC(StackTrace);
+    NO_MOVE_SEMANTIC(StackTrace);
+
+    std::string description_ {};
+    std::vector<std::shared_ptr<StackFrame>> callFrames_ {};
+    std::optional<std::unique_ptr<StackTraceId>> parentId_ {};
+};
+
 // ========== Debugger types begin
 // Debugger.ScriptLanguage
 struct ScriptLanguage {
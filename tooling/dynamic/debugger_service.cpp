@@ -45,6 +45,18 @@ void SetDebugApp(::panda::ecmascript::EcmaVM *vm)
     vm->GetJsDebuggerManager()->SetIsDebugApp(true);
 }
 
+void SetAsyncSendEnabled(const ::panda::ecmascript::EcmaVM *vm, bool enabled)
+{
+    if (vm == nullptr || vm->GetJsDebuggerManager() == nullptr) {
+        LOG_DEBUGGER(DEBUG) << "VM has already been destroyed";
+        return;
+    }
+    ProtocolHandler *handler = vm->GetJsDebuggerManager()->GetDebuggerHandler();
+    if (LIKELY(handler != nullptr)) {
+        handler->SetAsyncSendEnabled(enabled);
+    }
+}
+
 void UninitializeDebugger(::panda::ecmascript::EcmaVM *vm)
 {
     if (vm == nullptr || vm->GetJsDebuggerManager() == nullptr) {
@@ -59,6 +59,10 @@ TOOLCHAIN_EXPORT DebugResponse OperateDebugMessage(const ::panda::ecmascript::Ec
 
 TOOLCHAIN_EXPORT void SetDebugApp(::panda::ecmascript::EcmaVM *vm);
 
+// Off by default. When enabled, onResponse of InitializeDebugger is called on a dedicated thread, so it
+// must be thread safe, and UninitializeDebugger must not be called with a lock held which onResponse takes
+TOOLCHAIN_EXPORT void SetAsyncSendEnabled(const ::panda::ecmascript::EcmaVM *vm, bool enabled);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
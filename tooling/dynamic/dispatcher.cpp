@@ -28,11 +28,12 @@
 #include "agent/overlay_impl.h"
 #include "agent/page_impl.h"
 #include "agent/target_impl.h"
+#include "agent/toolchain_impl.h"
 #include "agent/tracing_impl.h"
 #include "protocol_channel.h"
 
 namespace panda::ecmascript::tooling {
-DispatchRequest::DispatchRequest(const std::string &message)
+DispatchRequest::DispatchRequest(const std::string &message) : messageSize_(message.size())
 {
     std::unique_ptr<PtJson> json = PtJson::Parse(message);
     if (json == nullptr) {
@@ -213,6 +214,16 @@ Dispatcher::Dispatcher(const EcmaVM *vm, ProtocolChannel *channel, bool isHybrid
     auto animation = std::make_unique<AnimationImpl>();
     dispatchers_["Animation"] =
         std::make_unique<AnimationImpl::DispatcherImpl>(channel, std::move(animation));
+
+    auto toolchain = std::make_unique<ToolchainImpl>(metrics_.get());
+    dispatchers_["Toolchain"] =
+        std::make_unique<ToolchainImpl::DispatcherImpl>(channel, std::move(toolchain));
+}
+
+Dispatcher::~Dispatcher()
+{
+    // the debugger agent unhooks itself from the runtime agent when destroyed, so it goes first
+    dispatchers_.erase("Debugger");
 }
 
 std::optional<std::string> Dispatcher::Dispatch(const DispatchRequest &request, bool crossLanguageDebug) const
@@ -224,7 +235,17 @@ std::optional<std::string> Dispatcher::Dispatch(const DispatchRequest &request,
     const std::string &domain = request.GetDomain();
     auto dispatcher = dispatchers_.find(domain);
     if (dispatcher != dispatchers_.end()) {
-        return dispatcher->second->Dispatch(request, crossLanguageDebug);
+        if (LIKELY(!metrics_->IsEnabled())) {
+            return dispatcher->second->Dispatch(request, crossLanguageDebug);
+        }
+        metrics_->StartDispatch();
+        auto ret = dispatcher->second->Dispatch(request, crossLanguageDebug);
+        std::string method = domain + "." + request.GetMethod();
+        metrics_->RecordCall(method, metrics_->FinishDispatch(), request.GetMessageSize());
+        if (ret.has_value()) {
+            metrics_->RecordBytesOut(method, ret->size());
+        }
+        return ret;
     } else {
         if (domain == "Test") {
             if (request.GetMethod() == "fail") {
@@ -20,6 +20,7 @@
 #include <memory>
 #include <set>
 
+#include "tooling/dynamic/base/pt_metrics.h"
 #include "tooling/dynamic/base/pt_returns.h"
 
 #include "ecmascript/debugger/js_debugger_interface.h"
@@ -72,9 +73,14 @@ public:
     {
         return method_;
     }
+    size_t GetMessageSize() const
+    {
+        return messageSize_;
+    }
 
 private:
     int32_t callId_ = -1;
+    size_t messageSize_ {0};
     std::string domain_ {};
     std::string method_ {};
     std::unique_ptr<PtJson> params_ = std::make_unique<PtJson>();
@@ -150,13 +156,18 @@ private:
 class Dispatcher {
 public:
     explicit Dispatcher(const EcmaVM *vm, ProtocolChannel *channel, bool isHybrid = false);
-    ~Dispatcher() = default;
+    ~Dispatcher();
     std::optional<std::string> Dispatch(const DispatchRequest &request, bool crossLanguageDebug = false) const;
     std::string GetJsFrames() const;
     std::string OperateDebugMessage(const char* message) const;
+    ProtocolMetrics *GetProtocolMetrics() const
+    {
+        return metrics_.get();
+    }
 
 private:
     std::unordered_map<std::string, std::unique_ptr<DispatcherBase>> dispatchers_ {};
+    std::unique_ptr<ProtocolMetrics> metrics_ {std::make_unique<ProtocolMetrics>()};
 
     NO_COPY_SEMANTIC(Dispatcher);
     NO_MOVE_SEMANTIC(Dispatcher);
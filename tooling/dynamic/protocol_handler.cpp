@@ -15,7 +15,15 @@
 
 #include "protocol_handler.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace panda::ecmascript::tooling {
+ProtocolHandler::~ProtocolHandler()
+{
+    SetAsyncSendEnabled(false);
+}
+
 void ProtocolHandler::WaitForDebugger()
 {
     waitingForDebugger_ = true;
@@ -30,11 +38,57 @@ void ProtocolHandler::RunIfWaitingForDebugger()
 void ProtocolHandler::DispatchCommand(std::string &&msg)
 {
     LOG_DEBUGGER(DEBUG) << "ProtocolHandler::DispatchCommand: " << msg;
+    auto request = std::make_unique<DispatchRequest>(msg);
+    RequestPriority priority = GetRequestPriority(*request);
+    if (request->GetDomain() == "Debugger" && request->GetMethod() == "clientDisconnect") {
+        // nobody is waiting for the replies of the queued requests any more
+        CancelPendingRequests();
+    }
     std::unique_lock<std::mutex> queueLock(requestLock_);
-    requestQueue_.push(std::move(msg));
+    RequestLane lane = priority == RequestPriority::BULK ? BULK_LANE : ORDERED_LANE;
+    if (lane == ORDERED_LANE && HasBulkRequest(request->GetDomain())) {
+        // must not overtake a bulk request of its own domain, e.g. Profiler.disable after Profiler.stop
+        lane = BULK_LANE;
+    }
+    requestQueues_[lane].push_back(std::move(request));
+    pendingRequestCount_.fetch_add(1, std::memory_order_relaxed);
     requestQueueCond_.notify_one();
 }
 
+size_t ProtocolHandler::CancelPendingRequests()
+{
+    std::unique_lock<std::mutex> queueLock(requestLock_);
+    size_t count = 0;
+    for (auto &queue : requestQueues_) {
+        count += queue.size();
+        RequestQueue().swap(queue);
+    }
+    pendingRequestCount_.store(0, std::memory_order_relaxed);
+    LOG_DEBUGGER(INFO) << "ProtocolHandler::CancelPendingRequests: " << count << " requests are canceled";
+    return count;
+}
+
+ProtocolHandler::RequestPriority ProtocolHandler::GetRequestPriority(const DispatchRequest &request)
+{
+    // requests which may take a long time to handle or produce a large reply
+    static const std::unordered_set<std::string> bulkMethods {
+        "Debugger.getPossibleBreakpoints",
+        "Debugger.getScriptSource",
+        "HeapProfiler.takeHeapSnapshot",
+        "HeapProfiler.stopTrackingHeapObjects",
+        "HeapProfiler.getSamplingProfile",
+        "Profiler.stop",
+    };
+    if (!request.IsValid()) {
+        return RequestPriority::ORDERED;
+    }
+    std::string method = request.GetDomain() + "." + request.GetMethod();
+    if (bulkMethods.find(method) != bulkMethods.end()) {
+        return RequestPriority::BULK;
+    }
+    return RequestPriority::ORDERED;
+}
+
 // called after DispatchCommand
 int32_t ProtocolHandler::GetDispatchStatus()
 {
@@ -42,39 +96,76 @@ int32_t ProtocolHandler::GetDispatchStatus()
         return DispatchStatus::DISPATCHING;
     }
     std::unique_lock<std::mutex> queueLock(requestLock_);
-    if (requestQueue_.empty()) {
+    if (IsRequestQueueEmpty()) {
         return DispatchStatus::DISPATCHED;
     }
     return DispatchStatus::UNKNOWN;
 }
 
+// should be called with requestLock_ held
+bool ProtocolHandler::IsRequestQueueEmpty() const
+{
+    for (const auto &queue : requestQueues_) {
+        if (!queue.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// should be called with requestLock_ held
+bool ProtocolHandler::HasBulkRequest(const std::string &domain) const
+{
+    const RequestQueue &queue = requestQueues_[BULK_LANE];
+    return std::any_of(queue.begin(), queue.end(), [&domain](const std::unique_ptr<DispatchRequest> &request) {
+        return request->GetDomain() == domain;
+    });
+}
+
+std::unique_ptr<DispatchRequest> ProtocolHandler::PopNextRequest()
+{
+    std::unique_lock<std::mutex> queueLock(requestLock_);
+    for (auto &queue : requestQueues_) {
+        if (!queue.empty()) {
+            std::unique_ptr<DispatchRequest> request = std::move(queue.front());
+            queue.pop_front();
+            pendingRequestCount_.fetch_sub(1, std::memory_order_relaxed);
+            return request;
+        }
+    }
+    return nullptr;
+}
+
 void ProtocolHandler::ProcessCommand()
 {
-    std::queue<std::string> dispatchingQueue;
+    // polled on every bytecode while debugging, a request queued meanwhile is handled on the next one
+    if (LIKELY(!waitingForDebugger_ && pendingRequestCount_.load(std::memory_order_relaxed) == 0)) {
+        return;
+    }
     do {
         DebuggerApi::DebuggerNativeScope nativeScope(vm_);
         {
             std::unique_lock<std::mutex> queueLock(requestLock_);
-            if (requestQueue_.empty()) {
+            if (IsRequestQueueEmpty()) {
                 if (!waitingForDebugger_) {
                     return;
                 }
                 requestQueueCond_.wait(queueLock);
             }
-            requestQueue_.swap(dispatchingQueue);
         }
 
         isDispatchingMessage_ = true;
         {
             DebuggerApi::DebuggerManagedScope managedScope(vm_);
-            while (!dispatchingQueue.empty()) {
-                std::string msg = std::move(dispatchingQueue.front());
-                dispatchingQueue.pop();
-
+            // pop one request at a time, so that a request arriving during dispatching
+            // is handled before the remaining bulk requests
+            std::unique_ptr<DispatchRequest> request = PopNextRequest();
+            while (request != nullptr) {
                 [[maybe_unused]] LocalScope scope(vm_);
                 auto exception = DebuggerApi::GetAndClearException(vm_);
-                dispatcher_.Dispatch(DispatchRequest(msg));
+                dispatcher_.Dispatch(*request);
                 DebuggerApi::SetException(vm_, exception);
+                request = PopNextRequest();
             }
         }
         isDispatchingMessage_ = false;
@@ -86,6 +177,10 @@ void ProtocolHandler::SendResponse(const DispatchRequest &request, const Dispatc
 {
     LOG_DEBUGGER(INFO) << "ProtocolHandler::SendResponse: "
                         << (response.IsOk() ? "success" : "failed: " + response.GetMessage());
+    ProtocolMetrics *metrics = dispatcher_.GetProtocolMetrics();
+    if (UNLIKELY(metrics->IsEnabled())) {
+        metrics->StopDispatch();
+    }
 
     std::unique_ptr<PtJson> reply = PtJson::CreateObject();
     reply->Add("id", request.GetCallId());
@@ -96,16 +191,22 @@ void ProtocolHandler::SendResponse(const DispatchRequest &request, const Dispatc
         resultObj = CreateErrorReply(response);
     }
     reply->Add("result", resultObj);
-    SendReply(*reply);
-    reply->ReleaseRoot();
+    std::string metricsKey;
+    if (UNLIKELY(metrics->IsEnabled())) {
+        metricsKey = request.GetDomain() + "." + request.GetMethod();
+    }
+    PostReply(std::move(reply), std::move(metricsKey), false);
 }
 
 void ProtocolHandler::SendNotification(const PtBaseEvents &events)
 {
     LOG_DEBUGGER(DEBUG) << "ProtocolHandler::SendNotification: " << events.GetName();
     std::unique_ptr<PtJson> reply = events.ToJson();
-    SendReply(*reply);
-    reply->ReleaseRoot();
+    std::string metricsKey;
+    if (UNLIKELY(dispatcher_.GetProtocolMetrics()->IsEnabled())) {
+        metricsKey = events.GetName();
+    }
+    PostReply(std::move(reply), std::move(metricsKey), true);
 }
 
 void ProtocolHandler::SendReply(const PtJson &reply)
@@ -119,6 +220,88 @@ void ProtocolHandler::SendReply(const PtJson &reply)
     callback_(reinterpret_cast<const void *>(vm_), str);
 }
 
+// the json tree of reply holds no vm object, so it is safe to stringify it out of the js thread
+void ProtocolHandler::PostReply(std::unique_ptr<PtJson> reply, std::string metricsKey, bool isEvent)
+{
+    PendingReply pendingReply {std::move(metricsKey), isEvent, std::move(reply)};
+    {
+        std::unique_lock<std::mutex> sendLock(sendLock_);
+        if (asyncSendEnabled_) {
+            sendQueue_.push(std::move(pendingReply));
+            sendQueueCond_.notify_one();
+            return;
+        }
+    }
+    FlushReply(pendingReply);
+}
+
+void ProtocolHandler::FlushReply(const PendingReply &reply)
+{
+    const auto &[metricsKey, isEvent, json] = reply;
+    std::string str = json->Stringify();
+    json->ReleaseRoot();
+    if (str.empty()) {
+        LOG_DEBUGGER(ERROR) << "ProtocolHandler::FlushReply: json stringify error";
+        return;
+    }
+
+    callback_(reinterpret_cast<const void *>(vm_), str);
+    if (metricsKey.empty()) {
+        return;
+    }
+    if (isEvent) {
+        dispatcher_.GetProtocolMetrics()->RecordEventOut(metricsKey, str.size());
+    } else {
+        dispatcher_.GetProtocolMetrics()->RecordBytesOut(metricsKey, str.size());
+    }
+}
+
+void ProtocolHandler::SendLoop()
+{
+    std::queue<PendingReply> sendingQueue;
+    do {
+        {
+            std::unique_lock<std::mutex> sendLock(sendLock_);
+            sendQueueCond_.wait(sendLock, [this] { return stopSending_ || !sendQueue_.empty(); });
+            if (sendQueue_.empty()) {
+                // stopped and all the pending replies have been sent
+                return;
+            }
+            sendQueue_.swap(sendingQueue);
+        }
+        while (!sendingQueue.empty()) {
+            FlushReply(sendingQueue.front());
+            sendingQueue.pop();
+        }
+    } while (true);
+}
+
+void ProtocolHandler::SetAsyncSendEnabled(bool enabled)
+{
+    {
+        std::unique_lock<std::mutex> sendLock(sendLock_);
+        if (asyncSendEnabled_ == enabled) {
+            return;
+        }
+        asyncSendEnabled_ = enabled;
+        stopSending_ = !enabled;
+        if (enabled) {
+            sendThread_ = std::thread(&ProtocolHandler::SendLoop, this);
+            return;
+        }
+        sendQueueCond_.notify_one();
+    }
+    if (sendThread_.joinable()) {
+        sendThread_.join();
+    }
+}
+
+bool ProtocolHandler::IsAsyncSendEnabled()
+{
+    std::unique_lock<std::mutex> sendLock(sendLock_);
+    return asyncSendEnabled_;
+}
+
 std::unique_ptr<PtJson> ProtocolHandler::CreateErrorReply(const DispatchResponse &response)
 {
     std::unique_ptr<PtJson> result = PtJson::CreateObject();
@@ -16,10 +16,13 @@
 #ifndef ECMASCRIPT_TOOLING_PROTOCOL_HANDLER_H
 #define ECMASCRIPT_TOOLING_PROTOCOL_HANDLER_H
 
+#include <array>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <queue>
 #include <memory>
+#include <thread>
 
 #include "protocol_channel.h"
 
@@ -32,17 +35,30 @@ public:
         DISPATCHED
     };
 
+    // Ordered requests are dispatched in their arrival order, as a request may depend on the
+    // state left by the ones before it, e.g. getProperties queued before resume needs the vm paused.
+    // Bulk requests are overtaken by the later requests of other domains only, so that e.g. a heap snapshot
+    // does not delay a resume, while the requests of a domain always keep their arrival order, e.g. the profiler
+    // must not be destroyed by HeapProfiler.disable before a queued HeapProfiler.stopTrackingHeapObjects.
+    enum class RequestPriority : uint8_t {
+        ORDERED = 0,
+        BULK
+    };
+
     ProtocolHandler(std::function<void(const void *, const std::string &)> callback, const EcmaVM *vm,
                     bool isHybrid = false)
         : callback_(std::move(callback)), dispatcher_(vm, this, isHybrid), vm_(vm), isHybrid_(isHybrid) {}
 
-    ~ProtocolHandler() override = default;
+    ~ProtocolHandler() override;
 
     void WaitForDebugger() override;
     void RunIfWaitingForDebugger() override;
     void ProcessCommand();
     void DispatchCommand(std::string &&msg);
     int32_t GetDispatchStatus();
+    // drop the queued requests which have not been dispatched yet, returns the number of dropped requests
+    size_t CancelPendingRequests();
+    static RequestPriority GetRequestPriority(const DispatchRequest &request);
 
     void SendResponse(const DispatchRequest &request, const DispatchResponse &response,
                       const PtBaseReturns &result) override;
@@ -50,6 +66,12 @@ public:
 
     std::unique_ptr<PtJson> CreateErrorReply(const DispatchResponse &response);
     void SendReply(const PtJson &reply);
+    // When enabled, replies are built on the js thread but stringified and sent on a dedicated thread
+    // in the same order as they are produced, so the callback must be thread safe.
+    // Disabling it flushes all pending replies before returning. Off by default, the embedder turns it on
+    // through SetAsyncSendEnabled of debugger_service.h.
+    void SetAsyncSendEnabled(bool enabled);
+    bool IsAsyncSendEnabled();
     const Dispatcher* GetDispatcher() const
     {
         return &dispatcher_;
@@ -63,6 +85,28 @@ private:
     NO_MOVE_SEMANTIC(ProtocolHandler);
     NO_COPY_SEMANTIC(ProtocolHandler);
 
+    using RequestQueue = std::deque<std::unique_ptr<DispatchRequest>>;
+    // the lane of requestQueues_ a request is queued in
+    enum RequestLane : uint8_t {
+        ORDERED_LANE = 0,
+        BULK_LANE,
+        NUM_OF_LANES
+    };
+
+    bool IsRequestQueueEmpty() const;
+    bool HasBulkRequest(const std::string &domain) const;
+    std::unique_ptr<DispatchRequest> PopNextRequest();
+    struct PendingReply {
+        // the method or the event which the reply is recorded to, empty if the metrics is disabled
+        std::string metricsKey {};
+        bool isEvent {false};
+        std::unique_ptr<PtJson> json {};
+    };
+
+    void PostReply(std::unique_ptr<PtJson> reply, std::string metricsKey, bool isEvent);
+    void FlushReply(const PendingReply &reply);
+    void SendLoop();
+
     std::function<void(const void *, const std::string &)> callback_;
     Dispatcher dispatcher_;
 
@@ -70,10 +114,20 @@ private:
     const EcmaVM *vm_ {nullptr};
 
     std::condition_variable requestQueueCond_;
-    std::queue<std::string> requestQueue_;
+    std::array<RequestQueue, NUM_OF_LANES> requestQueues_ {};
     std::mutex requestLock_;
+    // number of the requests in requestQueues_, changed with requestLock_ held, so that ProcessCommand
+    // can return without locking when nothing is queued
+    std::atomic<uint32_t> pendingRequestCount_ {0};
     std::atomic<bool> isDispatchingMessage_ {false};
     bool isHybrid_ {false};
+
+    std::thread sendThread_;
+    std::condition_variable sendQueueCond_;
+    std::queue<PendingReply> sendQueue_;
+    std::mutex sendLock_;
+    bool asyncSendEnabled_ {false};
+    bool stopSending_ {false};
 };
 }  // namespace panda::ecmascript::tooling
 
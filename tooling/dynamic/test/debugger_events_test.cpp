@@ -124,6 +124,47 @@ HWTEST_F_L0(DebuggerEventsTest, PausedToJsonTest)
     ASSERT_EQ(json1->GetObject("params", &params), Result::SUCCESS);
 }
 
+HWTEST_F_L0(DebuggerEventsTest, PausedHasMoreToJsonTest)
+{
+    Paused paused;
+    paused.SetReason(PauseReason::INSTRUMENTATION);
+    std::unique_ptr<PtJson> params;
+    ASSERT_EQ(paused.ToJson()->GetObject("params", &params), Result::SUCCESS);
+    bool hasMore = false;
+    EXPECT_EQ(params->GetBool("hasMore", &hasMore), Result::NOT_EXIST);
+
+    paused.SetHasMore(true);
+    ASSERT_EQ(paused.ToJson()->GetObject("params", &params), Result::SUCCESS);
+    ASSERT_EQ(params->GetBool("hasMore", &hasMore), Result::SUCCESS);
+    EXPECT_TRUE(hasMore);
+    EXPECT_TRUE(paused.GetHasMore());
+}
+
+HWTEST_F_L0(DebuggerEventsTest, PausedAsyncStackTraceToJsonTest)
+{
+    Paused paused;
+    paused.SetReason(PauseReason::INSTRUMENTATION);
+    std::unique_ptr<StackTrace> stackTrace = std::make_unique<StackTrace>();
+    std::unique_ptr<StackTraceId> parentId = std::make_unique<StackTraceId>();
+    parentId->SetId("1");
+    stackTrace->SetDescription("then").SetParentId(std::move(parentId));
+    paused.SetAsyncStackTrace(std::move(stackTrace));
+    ASSERT_NE(paused.GetAsyncStackTrace(), nullptr);
+
+    std::unique_ptr<PtJson> params;
+    ASSERT_EQ(paused.ToJson()->GetObject("params", &params), Result::SUCCESS);
+    std::unique_ptr<PtJson> asyncStackTrace;
+    ASSERT_EQ(params->GetObject("asyncStackTrace", &asyncStackTrace), Result::SUCCESS);
+    // the parent is referred to by id instead of being inlined
+    std::unique_ptr<PtJson> parent;
+    EXPECT_EQ(asyncStackTrace->GetObject("parent", &parent), Result::NOT_EXIST);
+    std::unique_ptr<PtJson> json;
+    ASSERT_EQ(asyncStackTrace->GetObject("parentId", &json), Result::SUCCESS);
+    std::string id;
+    ASSERT_EQ(json->GetString("id", &id), Result::SUCCESS);
+    EXPECT_EQ(id, "1");
+}
+
 HWTEST_F_L0(DebuggerEventsTest, NativeCallingToJsonTest)
 {
     NativeCalling nativeCalling;
@@ -304,6 +345,74 @@ HWTEST_F_L0(DebuggerEventsTest, ScriptParsedToJsonTest)
     EXPECT_EQ("hh", tmpStr);
 }
 
+HWTEST_F_L0(DebuggerEventsTest, ScriptsParsedToJsonTest)
+{
+    std::vector<std::unique_ptr<ScriptParsed>> scripts;
+    for (int32_t i = 0; i < 3; i++) { // 3: scripts of the chunk
+        auto parsed = std::make_unique<ScriptParsed>();
+        parsed->SetScriptId(i).SetUrl("use/test" + std::to_string(i) + ".js").SetEndLine(10).SetHash("hash0001");
+        scripts.emplace_back(std::move(parsed));
+    }
+    ScriptsParsed scriptsParsed;
+    scriptsParsed.SetScripts(std::move(scripts));
+    EXPECT_EQ(scriptsParsed.GetName(), "Debugger.scriptsParsed");
+
+    std::unique_ptr<PtJson> json = scriptsParsed.ToJson();
+    std::string tmpStr;
+    ASSERT_EQ(json->GetString("method", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ("Debugger.scriptsParsed", tmpStr);
+    std::unique_ptr<PtJson> params;
+    ASSERT_EQ(json->GetObject("params", &params), Result::SUCCESS);
+    std::unique_ptr<PtJson> array;
+    ASSERT_EQ(params->GetArray("scripts", &array), Result::SUCCESS);
+    ASSERT_EQ(array->GetSize(), 3); // 3: scripts of the chunk
+
+    // each script carries the params of its Debugger.scriptParsed
+    std::unique_ptr<PtJson> script = array->Get(2);
+    ASSERT_EQ(script->GetString("scriptId", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ("2", tmpStr);
+    ASSERT_EQ(script->GetString("url", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ("use/test2.js", tmpStr);
+    int tmpInt;
+    ASSERT_EQ(script->GetInt("endLine", &tmpInt), Result::SUCCESS);
+    EXPECT_EQ(tmpInt, 10);
+    ASSERT_EQ(script->GetString("hash", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ("hash0001", tmpStr);
+    EXPECT_EQ(script->Stringify(), ScriptParsed().SetScriptId(2).SetUrl("use/test2.js").SetEndLine(10)
+        .SetHash("hash0001").ParamsToJson()->Stringify());
+}
+
+HWTEST_F_L0(DebuggerEventsTest, ConsoleAPICalledToJsonTest)
+{
+    ConsoleAPICalled consoleAPICalled;
+    std::vector<std::unique_ptr<RemoteObject>> args;
+    args.emplace_back(RemoteObject::FromTagged(ecmaVm, StringRef::NewFromUtf8(ecmaVm, "i = 999")));
+    consoleAPICalled.SetType("log").SetArgs(std::move(args)).SetExecutionContextId(1).SetTimestamp(77);
+
+    std::unique_ptr<PtJson> json = consoleAPICalled.ToJson();
+    std::string method;
+    ASSERT_EQ(json->GetString("method", &method), Result::SUCCESS);
+    EXPECT_EQ(consoleAPICalled.GetName(), method);
+    std::unique_ptr<PtJson> params;
+    ASSERT_EQ(json->GetObject("params", &params), Result::SUCCESS);
+
+    std::string type;
+    ASSERT_EQ(params->GetString("type", &type), Result::SUCCESS);
+    EXPECT_EQ(type, "log");
+    std::unique_ptr<PtJson> argsJson;
+    ASSERT_EQ(params->GetArray("args", &argsJson), Result::SUCCESS);
+    ASSERT_EQ(argsJson->GetSize(), 1);
+    std::string description;
+    ASSERT_EQ(argsJson->Get(0)->GetString("description", &description), Result::SUCCESS);
+    EXPECT_EQ(description, "i = 999");
+    int executionContextId;
+    ASSERT_EQ(params->GetInt("executionContextId", &executionContextId), Result::SUCCESS);
+    EXPECT_EQ(executionContextId, 1);
+    double timestamp;
+    ASSERT_EQ(params->GetDouble("timestamp", &timestamp), Result::SUCCESS);
+    EXPECT_EQ(timestamp, 77);
+}
+
 HWTEST_F_L0(DebuggerEventsTest, ConsoleProfileFinishedToJsonTest)
 {
     ConsoleProfileFinished consoleProfileFinished;
@@ -13,6 +13,14 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <thread>
+
 #include "agent/debugger_impl.h"
 #include "ecmascript/tests/test_helper.h"
 #include "protocol_channel.h"
@@ -43,6 +51,11 @@ public:
         return debuggerImpl_->mixStackEnabled_;
     }
 
+    bool GetAsyncStackTraceId()
+    {
+        return debuggerImpl_->asyncStackTraceId_;
+    }
+
     bool DecodeAndCheckBase64(const std::string &src, std::vector<uint8_t> &dest)
     {
         return debuggerImpl_->DecodeAndCheckBase64(src, dest);
@@ -88,6 +101,21 @@ public:
         return debuggerImpl_->CheckPauseOnException();
     }
 
+    bool MatchExceptionErrorName(Local<JSValueRef> exception)
+    {
+        return debuggerImpl_->MatchExceptionErrorName(exception);
+    }
+
+    bool MatchExceptionUrl(const std::string &url)
+    {
+        return debuggerImpl_->MatchExceptionUrl(url);
+    }
+
+    bool SampleExceptionSite(const JSPtLocation &location)
+    {
+        return debuggerImpl_->SampleExceptionSite(location);
+    }
+
     void GeneratePausedInfo(PauseReason pauseReason, std::vector<std::string> &hitBreakpoints,
         Local<JSValueRef> exception)
     {
@@ -126,6 +154,64 @@ public:
         debuggerImpl_->frontend_.ScriptParsed(ecmaVm, script);
     }
 
+    void SaveParsedScriptsAndUrl(const std::string &fileName, const std::string &url, const std::string &recordName)
+    {
+        debuggerImpl_->SaveParsedScriptsAndUrl(fileName, url, recordName);
+    }
+
+    int32_t GetEndLine(const DebugInfoFileKey &key, const std::string &url,
+        const FileDebugInfo::EndLinesScanner &scanner)
+    {
+        return debuggerImpl_->GetFileDebugInfo(key)->GetEndLine(url, scanner);
+    }
+
+    const PtBreakpointCache &GetBreakpointsCache() const
+    {
+        return debuggerImpl_->breakpointsCache_;
+    }
+
+    size_t GetFileDebugInfoSourceFileCount(const DebugInfoFileKey &key)
+    {
+        auto iter = debuggerImpl_->fileDebugInfos_.find(key);
+        return iter == debuggerImpl_->fileDebugInfos_.end() ? 0 : iter->second->GetSourceFileCount();
+    }
+
+    PtScript *MatchScripts(const std::string &matchStr, ScriptMatchType type)
+    {
+        PtScript *result = nullptr;
+        auto scriptFunc = [&result](PtScript *script) -> bool {
+            result = script;
+            return true;
+        };
+        debuggerImpl_->MatchScripts(scriptFunc, matchStr, type);
+        return result;
+    }
+
+    std::vector<PtScript *> MatchAllScripts(const std::string &url)
+    {
+        return debuggerImpl_->MatchAllScripts(url);
+    }
+
+    void EnableLaunchAccelerateMode()
+    {
+        debuggerImpl_->EnableLaunchAccelerateMode();
+    }
+
+    bool InsertIntoPendingBreakpoints(const BreakpointInfo &breakpoint)
+    {
+        return debuggerImpl_->InsertIntoPendingBreakpoints(breakpoint);
+    }
+
+    void AddScript(const std::shared_ptr<PtScript> &script)
+    {
+        debuggerImpl_->AddScript(script);
+    }
+
+    size_t GetScriptSourceCacheSize()
+    {
+        return debuggerImpl_->scriptSourceCache_.GetSize();
+    }
+
 private:
     std::unique_ptr<DebuggerImpl> debuggerImpl_;
 };
@@ -149,6 +235,33 @@ public:
     std::string notificationName;
 };
 
+class ScriptsCountingProtocolChannel : public ProtocolChannel {
+public:
+    ScriptsCountingProtocolChannel() = default;
+    ~ScriptsCountingProtocolChannel() override = default;
+    void WaitForDebugger() override {}
+    void RunIfWaitingForDebugger() override {}
+    void SendResponse(const DispatchRequest &request, const DispatchResponse &response,
+                      const PtBaseReturns &result) override {}
+
+    // serialized as ProtocolHandler does, one message per notification
+    void SendNotification(const PtBaseEvents &events) override
+    {
+        notificationCount++;
+        notificationBytes += events.ToJson()->Stringify().size();
+        if (events.GetName() == "Debugger.scriptParsed") {
+            scriptIds.insert(static_cast<const ScriptParsed &>(events).GetScriptId());
+        } else if (events.GetName() == "Debugger.scriptsParsed") {
+            for (const auto &script : *static_cast<const ScriptsParsed &>(events).GetScripts()) {
+                scriptIds.insert(script->GetScriptId());
+            }
+        }
+    }
+    size_t notificationCount {0};
+    size_t notificationBytes {0};
+    std::unordered_set<ScriptId> scriptIds {};
+};
+
 namespace panda::test {
 class DebuggerImplTest : public testing::Test {
 public:
@@ -1340,7 +1453,79 @@ HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_SetBlackboxPatterns__001)
 
     dispatcherImpl->Dispatch(request);
     EXPECT_STREQ(outStrForCallbackCheck.c_str(),
-        R"({"id":0,"result":{"code":1,"message":"SetBlackboxPatterns not support now"}})");
+        R"({"id":0,"result":{"code":1,"message":"wrong params"}})");
+    if (protocolChannel) {
+        delete protocolChannel;
+        protocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_SetBlackboxPatterns__002)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    ProtocolChannel *protocolChannel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, protocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, protocolChannel, runtimeImpl.get());
+    auto dispatcherImpl = std::make_unique<DebuggerImpl::DispatcherImpl>(protocolChannel, std::move(debuggerImpl));
+
+    std::string msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.setBlackboxPatterns",
+            "params":{
+                "patterns":["oh_modules/", "\\.min\\.js$"]
+            }
+        })";
+    DispatchRequest request(msg);
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(), R"({"id":0,"result":{}})");
+
+    // groups and classes are not supported
+    msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.setBlackboxPatterns",
+            "params":{
+                "patterns":["(lib|vendor)/"]
+            }
+        })";
+    DispatchRequest unsupportedRequest(msg);
+    dispatcherImpl->Dispatch(unsupportedRequest);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(),
+        R"({"id":0,"result":{"code":1,"message":"Unsupported blackbox pattern: (lib|vendor)/"}})");
+    if (protocolChannel) {
+        delete protocolChannel;
+        protocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_SetBlackboxedRanges__001)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    ProtocolChannel *protocolChannel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, protocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, protocolChannel, runtimeImpl.get());
+    auto dispatcherImpl = std::make_unique<DebuggerImpl::DispatcherImpl>(protocolChannel, std::move(debuggerImpl));
+
+    std::string msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.setBlackboxedRanges",
+            "params":{
+                "scriptId":"-1",
+                "positions":[]
+            }
+        })";
+    DispatchRequest request(msg);
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(),
+        R"({"id":0,"result":{"code":1,"message":"unknown script id: -1"}})");
     if (protocolChannel) {
         delete protocolChannel;
         protocolChannel = nullptr;
@@ -1796,6 +1981,119 @@ HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_DropFrame__001)
     }
 }
 
+HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_SetPausedCallFramesLimit__001)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    ProtocolChannel *protocolChannel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, protocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, protocolChannel, runtimeImpl.get());
+    auto dispatcherImpl = std::make_unique<DebuggerImpl::DispatcherImpl>(protocolChannel, std::move(debuggerImpl));
+
+    std::string msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.setPausedCallFramesLimit",
+            "params":{"limit":true}
+        })";
+    DispatchRequest request(msg);
+
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(),
+        R"({"id":0,"result":{"code":1,"message":"wrong params"}})");
+    if (protocolChannel) {
+        delete protocolChannel;
+        protocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_SetPausedCallFramesLimit__002)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    ProtocolChannel *protocolChannel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, protocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, protocolChannel, runtimeImpl.get());
+    auto dispatcherImpl = std::make_unique<DebuggerImpl::DispatcherImpl>(protocolChannel, std::move(debuggerImpl));
+
+    std::string msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.setPausedCallFramesLimit",
+            "params":{"limit":50}
+        })";
+    DispatchRequest request(msg);
+
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(),
+        R"({"id":0,"result":{}})");
+    if (protocolChannel) {
+        delete protocolChannel;
+        protocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_GetCallFrames__001)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    ProtocolChannel *protocolChannel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, protocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, protocolChannel, runtimeImpl.get());
+    auto dispatcherImpl = std::make_unique<DebuggerImpl::DispatcherImpl>(protocolChannel, std::move(debuggerImpl));
+
+    std::string msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.getCallFrames",
+            "params":{"start":50}
+        })";
+    DispatchRequest request(msg);
+
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(),
+        R"({"id":0,"result":{"code":1,"message":"GetCallFrames: debugger is not paused"}})");
+    if (protocolChannel) {
+        delete protocolChannel;
+        protocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, Dispatcher_Dispatch_GetCallFrames__002)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    ProtocolChannel *protocolChannel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, protocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, protocolChannel, runtimeImpl.get());
+    debuggerImpl->SetDebuggerState(DebuggerState::PAUSED);
+    auto dispatcherImpl = std::make_unique<DebuggerImpl::DispatcherImpl>(protocolChannel, std::move(debuggerImpl));
+
+    std::string msg = std::string() +
+        R"({
+            "id":0,
+            "method":"Debugger.getCallFrames",
+            "params":{"start":50,"count":50}
+        })";
+    DispatchRequest request(msg);
+
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(),
+        R"({"id":0,"result":{"callFrames":[],"hasMore":false}})");
+    if (protocolChannel) {
+        delete protocolChannel;
+        protocolChannel = nullptr;
+    }
+}
+
 HWTEST_F_L0(DebuggerImplTest, DispatcherImplCallFunctionOn__001)
 {
     std::string outStrForCallbackCheck = "";
@@ -2529,6 +2827,110 @@ HWTEST_F_L0(DebuggerImplTest, CheckPauseOnException__002)
     }
 }
 
+HWTEST_F_L0(DebuggerImplTest, ExceptionErrorNameFilterTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    Local<StringRef> message = StringRef::NewFromUtf8(ecmaVm, "Test exception");
+    Local<JSValueRef> typeError = Exception::TypeError(ecmaVm, message);
+    Local<JSValueRef> rangeError = Exception::RangeError(ecmaVm, message);
+    Local<JSValueRef> thrownString = StringRef::NewFromUtf8(ecmaVm, "TypeError");
+
+    // without the filter every exception pauses
+    auto params = SetPauseOnExceptionsParams::Create(*PtJson::Parse(R"({"state":"all"})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetPauseOnExceptions(*params).IsOk());
+    EXPECT_TRUE(testHelper.MatchExceptionErrorName(typeError));
+    EXPECT_TRUE(testHelper.MatchExceptionErrorName(thrownString));
+
+    // with it only the errors of the constructors listed do, and a thrown primitive has no constructor
+    params = SetPauseOnExceptionsParams::Create(*PtJson::Parse(R"({"state":"all","errorNames":["TypeError"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetPauseOnExceptions(*params).IsOk());
+    EXPECT_TRUE(testHelper.MatchExceptionErrorName(typeError));
+    EXPECT_FALSE(testHelper.MatchExceptionErrorName(rangeError));
+    EXPECT_FALSE(testHelper.MatchExceptionErrorName(thrownString));
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, ExceptionUrlFilterTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    EXPECT_TRUE(testHelper.MatchExceptionUrl("oh_modules/lib/Util.ts"));
+
+    // the url patterns are matched as the blackbox patterns
+    auto params = SetPauseOnExceptionsParams::Create(
+        *PtJson::Parse(R"({"state":"all","urlPatterns":["^entry/", "Page\\.ts$"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetPauseOnExceptions(*params).IsOk());
+    EXPECT_TRUE(testHelper.MatchExceptionUrl("entry/Index.ts"));
+    EXPECT_TRUE(testHelper.MatchExceptionUrl("oh_modules/lib/Page.ts"));
+    EXPECT_FALSE(testHelper.MatchExceptionUrl("oh_modules/lib/Util.ts"));
+    EXPECT_FALSE(testHelper.MatchExceptionUrl("oh_modules/entry/Util.ts"));
+
+    // an unsupported pattern leaves the filters as they are
+    params = SetPauseOnExceptionsParams::Create(*PtJson::Parse(R"({"state":"all","urlPatterns":["[a-z]+"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_FALSE(debugger->SetPauseOnExceptions(*params).IsOk());
+    EXPECT_FALSE(testHelper.MatchExceptionUrl("oh_modules/lib/Util.ts"));
+
+    // a new state without the patterns drops them
+    params = SetPauseOnExceptionsParams::Create(*PtJson::Parse(R"({"state":"all"})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetPauseOnExceptions(*params).IsOk());
+    EXPECT_TRUE(testHelper.MatchExceptionUrl("oh_modules/lib/Util.ts"));
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, ExceptionSiteSamplerTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    // 1, 2: the offsets of two sites throwing in the same method
+    JSPtLocation site {nullptr, JSPtLocation::EntityId(1), 1};
+    JSPtLocation otherSite {nullptr, JSPtLocation::EntityId(1), 2};
+    EXPECT_TRUE(testHelper.SampleExceptionSite(site));
+    EXPECT_TRUE(testHelper.SampleExceptionSite(site));
+
+    auto params = SetPauseOnExceptionsParams::Create(*PtJson::Parse(R"({"state":"all","throwsPerPause":3})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetPauseOnExceptions(*params).IsOk());
+    // 7: throws of the site, paused on the first, the fourth and the seventh
+    std::vector<bool> pauses;
+    for (int32_t i = 0; i < 7; i++) {
+        pauses.emplace_back(testHelper.SampleExceptionSite(site));
+    }
+    EXPECT_EQ(pauses, std::vector<bool>({true, false, false, true, false, false, true}));
+    // the throws of another site are counted on their own
+    EXPECT_TRUE(testHelper.SampleExceptionSite(otherSite));
+    EXPECT_FALSE(testHelper.SampleExceptionSite(otherSite));
+
+    // setting the state again restarts the count
+    EXPECT_TRUE(debugger->SetPauseOnExceptions(*params).IsOk());
+    EXPECT_TRUE(testHelper.SampleExceptionSite(site));
+    EXPECT_FALSE(testHelper.SampleExceptionSite(site));
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
 HWTEST_F_L0(DebuggerImplTest, GeneratePausedInfo__001)
 {
     std::string outStrForCallbackCheck = "";
@@ -2763,4 +3165,608 @@ HWTEST_F_L0(DebuggerImplTest, Frontend_StepOver__001)
         mockProtocolChannel = nullptr;
     }
 }
+
+HWTEST_F_L0(DebuggerImplTest, MatchScriptsTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    testHelper.SaveParsedScriptsAndUrl("/data/storage/el1/bundle/entry/ets/modules.abc", "entry/Index.ts", "Index");
+    testHelper.SaveParsedScriptsAndUrl("/data/storage/el1/bundle/entry/ets/modules.abc", "entry/Util.ts", "Util");
+    // the same url in another abc file, such as a worker
+    testHelper.SaveParsedScriptsAndUrl("/data/storage/el1/bundle/entry/ets/widget.abc", "entry/Index.ts", "Index");
+
+    PtScript *script = testHelper.MatchScripts("entry/Index.ts", ScriptMatchType::URL);
+    ASSERT_NE(script, nullptr);
+    EXPECT_EQ(script->GetFileName(), "/data/storage/el1/bundle/entry/ets/modules.abc");
+    script = testHelper.MatchScripts("/data/storage/el1/bundle/entry/ets/widget.abc", ScriptMatchType::FILE_NAME);
+    ASSERT_NE(script, nullptr);
+    EXPECT_EQ(script->GetUrl(), "entry/Index.ts");
+    script = testHelper.MatchScripts("", ScriptMatchType::HASH);
+    ASSERT_NE(script, nullptr);
+    EXPECT_EQ(script->GetUrl(), "entry/Index.ts");
+    EXPECT_EQ(testHelper.MatchScripts("entry/Unknown.ts", ScriptMatchType::URL), nullptr);
+    EXPECT_EQ(testHelper.MatchScripts("unknown.abc", ScriptMatchType::FILE_NAME), nullptr);
+    EXPECT_EQ(testHelper.MatchScripts("unknown", ScriptMatchType::HASH), nullptr);
+
+    std::vector<PtScript *> scripts = testHelper.MatchAllScripts("entry/Index.ts");
+    ASSERT_EQ(scripts.size(), 2U);
+    EXPECT_EQ(scripts[0]->GetFileName(), "/data/storage/el1/bundle/entry/ets/modules.abc");
+    EXPECT_EQ(scripts[1]->GetFileName(), "/data/storage/el1/bundle/entry/ets/widget.abc");
+    EXPECT_LT(scripts[0]->GetScriptId(), scripts[1]->GetScriptId());
+    EXPECT_EQ(testHelper.MatchAllScripts("entry/Util.ts").size(), 1U);
+    EXPECT_TRUE(testHelper.MatchAllScripts("entry/Unknown.ts").empty());
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, MatchScriptsBenchmark)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    constexpr int32_t scriptCount = 10000;
+    for (int32_t i = 0; i < scriptCount; i++) {
+        testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/Module" + std::to_string(i) + ".ts",
+            "Module" + std::to_string(i));
+    }
+
+    // lookups as done for every frame of the paused call stacks
+    auto start = std::chrono::steady_clock::now();
+    int32_t matched = 0;
+    for (int32_t i = 0; i < scriptCount * 10; i++) { // 10: lookups per script
+        if (testHelper.MatchScripts("entry/Module" + std::to_string(i % scriptCount) + ".ts",
+            ScriptMatchType::URL) != nullptr) {
+            matched++;
+        }
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << "match " << scriptCount * 10 << " urls in " << scriptCount << " scripts: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << "us";
+    EXPECT_EQ(matched, scriptCount * 10);
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, SetPendingBreakpointsWhenParsingScriptTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    testHelper.EnableLaunchAccelerateMode();
+    constexpr int32_t scriptCount = 5000;
+    constexpr int32_t breakpointUrlCount = 100;
+    constexpr int32_t breakpointsPerUrl = 5;
+    for (int32_t i = 0; i < breakpointUrlCount; i++) {
+        for (int32_t line = 0; line < breakpointsPerUrl; line++) {
+            auto breakpoint = BreakpointInfo::CreateAsSharedPtr(line, 0,
+                "entry/Module" + std::to_string(i * (scriptCount / breakpointUrlCount)) + ".ts");
+            ASSERT_TRUE(testHelper.InsertIntoPendingBreakpoints(*breakpoint));
+        }
+    }
+
+    // the modules loaded at startup, each one only resolves the breakpoints of its own url
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < scriptCount; i++) {
+        testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/Module" + std::to_string(i) + ".ts",
+            "Module" + std::to_string(i));
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << "parse " << scriptCount << " scripts with " << breakpointUrlCount * breakpointsPerUrl
+                     << " pending breakpoints: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << "us";
+
+    size_t locationCount = 0;
+    for (int32_t i = 0; i < scriptCount; i++) {
+        PtScript *script = testHelper.MatchScripts("entry/Module" + std::to_string(i) + ".ts",
+            ScriptMatchType::URL);
+        ASSERT_NE(script, nullptr);
+        size_t expected = (i % (scriptCount / breakpointUrlCount) == 0) ? breakpointsPerUrl : 0;
+        EXPECT_EQ(script->GetLocations().size(), expected);
+        for (const auto &location : script->GetLocations()) {
+            EXPECT_NE(location->GetId(), "invalid");
+            EXPECT_EQ(location->GetScriptId(), script->GetScriptId());
+        }
+        locationCount += script->GetLocations().size();
+    }
+    EXPECT_EQ(locationCount, static_cast<size_t>(breakpointUrlCount * breakpointsPerUrl));
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, BlackboxPatternsUpdateTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/Index.ts", "Index");
+    testHelper.SaveParsedScriptsAndUrl("modules.abc", "oh_modules/lib/Util.ts", "Util");
+    testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/Vendor.min.js", "Vendor");
+    auto isBlackboxed = [&testHelper](const std::string &url) {
+        PtScript *script = testHelper.MatchScripts(url, ScriptMatchType::URL);
+        return script != nullptr && script->IsBlackboxed();
+    };
+    EXPECT_FALSE(isBlackboxed("oh_modules/lib/Util.ts"));
+
+    // the scripts already parsed are resolved against the new patterns
+    auto params = SetBlackboxPatternsParams::Create(*PtJson::Parse(R"({"patterns":["^oh_modules/", "\\.min\\.js$"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetBlackboxPatterns(*params).IsOk());
+    EXPECT_FALSE(isBlackboxed("entry/Index.ts"));
+    EXPECT_TRUE(isBlackboxed("oh_modules/lib/Util.ts"));
+    EXPECT_TRUE(isBlackboxed("entry/Vendor.min.js"));
+
+    // and so are the scripts parsed after them
+    testHelper.SaveParsedScriptsAndUrl("modules.abc", "oh_modules/lib/Log.ts", "Log");
+    testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/oh_modules/Page.ts", "Page");
+    EXPECT_TRUE(isBlackboxed("oh_modules/lib/Log.ts"));
+    EXPECT_FALSE(isBlackboxed("entry/oh_modules/Page.ts"));
+
+    // new patterns replace the old ones
+    params = SetBlackboxPatternsParams::Create(*PtJson::Parse(R"({"patterns":["Index|Page"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetBlackboxPatterns(*params).IsOk());
+    EXPECT_TRUE(isBlackboxed("entry/Index.ts"));
+    EXPECT_TRUE(isBlackboxed("entry/oh_modules/Page.ts"));
+    EXPECT_FALSE(isBlackboxed("oh_modules/lib/Util.ts"));
+    EXPECT_FALSE(isBlackboxed("entry/Vendor.min.js"));
+
+    // an unsupported pattern leaves the patterns as they are
+    params = SetBlackboxPatternsParams::Create(*PtJson::Parse(R"({"patterns":["[a-z]+"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_FALSE(debugger->SetBlackboxPatterns(*params).IsOk());
+    EXPECT_TRUE(isBlackboxed("entry/Index.ts"));
+
+    // no patterns, nothing is blackboxed
+    params = SetBlackboxPatternsParams::Create(*PtJson::Parse(R"({"patterns":[]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->SetBlackboxPatterns(*params).IsOk());
+    EXPECT_FALSE(isBlackboxed("entry/Index.ts"));
+
+    // the positions of the ranges are sorted
+    PtScript *script = testHelper.MatchScripts("entry/Index.ts", ScriptMatchType::URL);
+    ASSERT_NE(script, nullptr);
+    std::string scriptId = std::to_string(script->GetScriptId());
+    auto rangesParams = SetBlackboxedRangesParams::Create(*PtJson::Parse(R"({"scriptId":")" + scriptId +
+        R"(","positions":[{"lineNumber":10,"columnNumber":0},{"lineNumber":2,"columnNumber":0}]})"));
+    ASSERT_NE(rangesParams, nullptr);
+    EXPECT_FALSE(debugger->SetBlackboxedRanges(*rangesParams).IsOk());
+    EXPECT_TRUE(script->GetBlackboxedRanges().empty());
+    rangesParams = SetBlackboxedRangesParams::Create(*PtJson::Parse(R"({"scriptId":")" + scriptId +
+        R"(","positions":[{"lineNumber":2,"columnNumber":0},{"lineNumber":10,"columnNumber":0}]})"));
+    ASSERT_NE(rangesParams, nullptr);
+    EXPECT_TRUE(debugger->SetBlackboxedRanges(*rangesParams).IsOk());
+    EXPECT_EQ(script->GetBlackboxedRanges().size(), 2U);
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, IsUserCodeMergedRangesTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    auto address = [](uint64_t value) { return reinterpret_cast<const void *>(value); };
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(100)));
+
+    // out of order, overlapping, adjacent, nested and empty ranges
+    std::unique_ptr<SetNativeRangeParams> params = SetNativeRangeParams::Create(*PtJson::Parse(R"({"nativeRange":[
+        {"start":500,"end":600},{"start":100,"end":200},{"start":150,"end":300},{"start":301,"end":310},
+        {"start":520,"end":530},{"start":900,"end":800},{"start":1000,"end":1000}]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debuggerImpl->SetNativeRange(*params).IsOk());
+    // [100, 310] merged from three ranges
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(99)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(100)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(250)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(301)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(310)));
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(311)));
+    // [500, 600] holds the nested range
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(525)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(600)));
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(601)));
+    // the empty range holds nothing, a single address range holds itself
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(850)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(1000)));
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(1001)));
+
+    // the ranges are replaced, not added to
+    params = SetNativeRangeParams::Create(*PtJson::Parse(R"({"nativeRange":[{"start":2000,"end":3000}]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debuggerImpl->SetNativeRange(*params).IsOk());
+    EXPECT_FALSE(debuggerImpl->IsUserCode(address(100)));
+    EXPECT_TRUE(debuggerImpl->IsUserCode(address(2500)));
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, IsUserCodeBenchmark)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    // the code ranges of the native modules of a large app, 4096 bytes apart
+    constexpr uint64_t rangeCount = 500;
+    constexpr uint64_t rangeSize = 4096;
+    std::string ranges;
+    for (uint64_t i = rangeCount; i > 0; i--) {
+        uint64_t start = i * rangeSize * 2; // 2: a gap as large as each range
+        ranges += (ranges.empty() ? "" : ",") + std::string("{\"start\":") + std::to_string(start) +
+            ",\"end\":" + std::to_string(start + rangeSize - 1) + "}";
+    }
+    auto params = SetNativeRangeParams::Create(*PtJson::Parse("{\"nativeRange\":[" + ranges + "]}"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debuggerImpl->SetNativeRange(*params).IsOk());
+
+    // a lookup for every native call and return while stepping
+    constexpr uint64_t lookupCount = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t userCode = 0;
+    for (uint64_t i = 0; i < lookupCount; i++) {
+        uint64_t address = rangeSize * 2 + (i * 7919) % (rangeCount * rangeSize * 2); // 7919: spreads the addresses
+        if (debuggerImpl->IsUserCode(reinterpret_cast<const void *>(address))) {
+            userCode++;
+        }
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << "look up " << lookupCount << " addresses in " << rangeCount << " native ranges: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << "us";
+    // about half of the addresses are in the ranges, the others in the gaps between them
+    EXPECT_GT(userCode, lookupCount / 3); // 3: a third of the lookups
+    EXPECT_LT(userCode, lookupCount * 2 / 3); // 2, 3: two thirds of the lookups
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, EnableBatchScriptParsedBenchmark)
+{
+    // the modules of a large app, loaded before the debugger attaches
+    constexpr size_t scriptCount = 5000;
+    auto enable = [this](const std::string &enableParams, ScriptsCountingProtocolChannel *channel) {
+        auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, channel);
+        auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, channel, runtimeImpl.get());
+        DebuggerImpl *debugger = debuggerImpl.get();
+        DebuggerImplFriendTest testHelper(debuggerImpl);
+        ecmaVm->GetJsDebuggerManager()->SetDebugMode(false);
+        for (size_t i = 0; i < scriptCount; i++) {
+            std::string name = "Module" + std::to_string(i);
+            testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/src/main/ets/" + name + ".ts", name);
+        }
+        EXPECT_EQ(channel->notificationCount, 0U);
+        auto params = EnableParams::Create(*PtJson::Parse(enableParams));
+        EXPECT_NE(params, nullptr);
+        UniqueDebuggerId id;
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_TRUE(debugger->Enable(*params, &id).IsOk());
+        auto duration = std::chrono::steady_clock::now() - start;
+        ecmaVm->GetJsDebuggerManager()->SetDebugMode(false);
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+
+    ScriptsCountingProtocolChannel eventPerScript;
+    auto eventPerScriptUs = enable(R"({})", &eventPerScript);
+    ScriptsCountingProtocolChannel batched;
+    auto batchedUs = enable(R"({"options":["enableBatchScriptParsed"]})", &batched);
+    GTEST_LOG_(INFO) << "enable with " << scriptCount << " scripts: " << eventPerScript.notificationCount
+                     << " notifications of " << eventPerScript.notificationBytes << " bytes in " << eventPerScriptUs
+                     << "us, batched " << batched.notificationCount << " notifications of "
+                     << batched.notificationBytes << " bytes in " << batchedUs << "us";
+
+    // every script is sent once either way, the batched ones in chunks of 1000
+    EXPECT_EQ(eventPerScript.notificationCount, scriptCount);
+    EXPECT_EQ(eventPerScript.scriptIds.size(), scriptCount);
+    EXPECT_EQ(batched.notificationCount, scriptCount / 1000); // 1000: scripts per Debugger.scriptsParsed
+    EXPECT_EQ(batched.scriptIds.size(), scriptCount);
+}
+
+HWTEST_F_L0(DebuggerImplTest, EnableResetsBatchScriptParsedTest)
+{
+    ScriptsCountingProtocolChannel channel;
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, &channel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, &channel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    constexpr size_t scriptCount = 10;
+    for (size_t i = 0; i < scriptCount; i++) {
+        std::string name = "Module" + std::to_string(i);
+        testHelper.SaveParsedScriptsAndUrl("modules.abc", "entry/src/main/ets/" + name + ".ts", name);
+    }
+    UniqueDebuggerId id;
+    auto params = EnableParams::Create(*PtJson::Parse(R"({"options":["enableBatchScriptParsed"]})"));
+    ASSERT_NE(params, nullptr);
+    channel.notificationCount = 0;
+    EXPECT_TRUE(debugger->Enable(*params, &id).IsOk());
+    EXPECT_EQ(channel.notificationCount, 1U);
+    EXPECT_TRUE(debugger->Disable().IsOk());
+
+    // a frontend attaching again without the option gets a Debugger.scriptParsed per script
+    params = EnableParams::Create(*PtJson::Parse(R"({})"));
+    ASSERT_NE(params, nullptr);
+    channel.notificationCount = 0;
+    EXPECT_TRUE(debugger->Enable(*params, &id).IsOk());
+    EXPECT_EQ(channel.notificationCount, scriptCount);
+    EXPECT_TRUE(debugger->Disable().IsOk());
+}
+
+HWTEST_F_L0(DebuggerImplTest, ScriptSourceMemoryTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    // the modules of a large app, of 16KB source each, loaded from the debug info of their file
+    constexpr size_t scriptCount = 5000;
+    constexpr size_t sourceSize = 16 * 1024;
+    size_t loadCount = 0;
+    auto sourceLoader = [&loadCount]([[maybe_unused]] const std::string &fileName) {
+        loadCount++;
+        return std::string(sourceSize, 'a');
+    };
+    for (size_t i = 0; i < scriptCount; i++) {
+        testHelper.AddScript(std::make_shared<PtScript>(static_cast<ScriptId>(i), "modules.abc",
+            "entry/Module" + std::to_string(i) + ".ts", 100, sourceLoader)); // 100: lines of each source
+    }
+    // 4: sources kept by the cache of Debugger.enable
+    auto enableParams = EnableParams::Create(
+        *PtJson::Parse("{\"maxScriptsCacheSize\":" + std::to_string(4 * sourceSize) + "}"));
+    ASSERT_NE(enableParams, nullptr);
+    UniqueDebuggerId id;
+    EXPECT_TRUE(debugger->Enable(*enableParams, &id).IsOk());
+    ecmaVm->GetJsDebuggerManager()->SetDebugMode(false);
+    // parsing the scripts loads none of their sources
+    EXPECT_EQ(loadCount, 0U);
+
+    auto getScriptSource = [debugger](size_t scriptId) {
+        auto params = GetScriptSourceParams::Create(
+            *PtJson::Parse("{\"scriptId\":\"" + std::to_string(scriptId) + "\"}"));
+        std::string source;
+        EXPECT_TRUE(params != nullptr && debugger->GetScriptSource(*params, &source).IsOk());
+        return source.size();
+    };
+    // 100: scripts the frontend opens
+    constexpr size_t requestCount = 100;
+    for (size_t i = 0; i < requestCount; i++) {
+        EXPECT_EQ(getScriptSource(i * (scriptCount / requestCount)), sourceSize);
+    }
+    EXPECT_EQ(loadCount, requestCount);
+    // the sources held by the debugger are bounded by the cache, not by the sources of the app
+    EXPECT_EQ(testHelper.GetScriptSourceCacheSize(), 4 * sourceSize); // 4: sources kept by the cache
+    GTEST_LOG_(INFO) << scriptCount << " scripts of " << scriptCount * sourceSize << " bytes of source, "
+                     << requestCount << " sources requested, " << testHelper.GetScriptSourceCacheSize()
+                     << " bytes of source held";
+
+    // the source requested last is served from the cache, an evicted one is loaded again
+    EXPECT_EQ(getScriptSource((requestCount - 1) * (scriptCount / requestCount)), sourceSize);
+    EXPECT_EQ(loadCount, requestCount);
+    EXPECT_EQ(getScriptSource(0), sourceSize);
+    EXPECT_EQ(loadCount, requestCount + 1);
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, SharedDebugInfoAcrossVmsTest)
+{
+    // the workers of an app load the modules.abc of its main thread, of 2000 scripts of 20 methods each
+    constexpr size_t workerCount = 4;
+    constexpr uint32_t scriptCount = 2000;
+    constexpr int32_t methodCount = 20;
+    constexpr int32_t methodLines = 50;
+    const DebugInfoFileKey key {"/data/storage/el1/bundle/entry/ets/modules.abc", 0x5a5a5a5a}; // checksum
+    std::atomic<size_t> scanCount {0};
+    // walks a line table of methodLines lines for each method, as ScanEndLines does
+    FileDebugInfo::EndLinesScanner scanner = [&scanCount]() {
+        scanCount++;
+        FileDebugInfo::EndLines endLines {};
+        for (uint32_t i = 0; i < scriptCount; i++) {
+            int32_t &endLine = endLines["entry/Module" + std::to_string(i) + ".ts"];
+            for (int32_t line = 0; line < methodCount * methodLines; line++) {
+                endLine = std::max(endLine, line);
+            }
+        }
+        return endLines;
+    };
+    auto attach = [&key, &scanner](DebuggerImplFriendTest &testHelper) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < scriptCount; i++) {
+            EXPECT_EQ(testHelper.GetEndLine(key, "entry/Module" + std::to_string(i) + ".ts", scanner),
+                methodCount * methodLines - 1);
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    };
+    size_t filesBefore = PtDebugInfoCache::GetInstance()->GetFileCount();
+    {
+        MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+        auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+        auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+        DebuggerImplFriendTest testHelper(debuggerImpl);
+        auto mainDuration = attach(testHelper);
+        EXPECT_EQ(scanCount.load(), 1U);
+        EXPECT_EQ(PtDebugInfoCache::GetInstance()->GetFileCount(), filesBefore + 1);
+
+        // each worker has a VM and a debugger of its own, which keep attached until they are released
+        std::vector<std::promise<std::chrono::microseconds>> attached(workerCount);
+        std::promise<void> released;
+        std::shared_future<void> releasedFuture = released.get_future().share();
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < workerCount; i++) {
+            workers.emplace_back([&attach, &attached, releasedFuture, i]() {
+                EcmaVM *workerVm = nullptr;
+                EcmaHandleScope *workerScope = nullptr;
+                JSThread *workerThread = nullptr;
+                TestHelper::CreateEcmaVMWithScope(workerVm, workerThread, workerScope);
+                MockProtocolChannel *workerChannel = new MockProtocolChannel();
+                {
+                    auto workerRuntime = std::make_unique<RuntimeImpl>(workerVm, workerChannel);
+                    auto workerDebugger =
+                        std::make_unique<DebuggerImpl>(workerVm, workerChannel, workerRuntime.get());
+                    DebuggerImplFriendTest workerHelper(workerDebugger);
+                    attached[i].set_value(attach(workerHelper));
+                    releasedFuture.wait();
+                }
+                delete workerChannel;
+                TestHelper::DestroyEcmaVMWithScope(workerVm, workerScope);
+            });
+        }
+        std::chrono::microseconds workerDuration {0};
+        for (auto &workerAttached : attached) {
+            workerDuration += workerAttached.get_future().get();
+        }
+        // the workers found the end lines the main thread scanned, and all the VMs share one copy of them
+        EXPECT_EQ(scanCount.load(), 1U);
+        EXPECT_EQ(PtDebugInfoCache::GetInstance()->GetFileCount(), filesBefore + 1);
+        EXPECT_EQ(testHelper.GetFileDebugInfoSourceFileCount(key), scriptCount);
+        GTEST_LOG_(INFO) << (workerCount + 1) << " VMs of " << scriptCount << " scripts scanned the line tables "
+                         << "once instead of " << (workerCount + 1) << " times, attach of the main thread in "
+                         << mainDuration.count() << "us, of a worker in " << workerDuration.count() / workerCount
+                         << "us";
+        released.set_value();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        // released by the workers, the main thread still holds the debug info
+        EXPECT_EQ(PtDebugInfoCache::GetInstance()->GetFileCount(), filesBefore + 1);
+        if (mockProtocolChannel != nullptr) {
+            delete mockProtocolChannel;
+            mockProtocolChannel = nullptr;
+        }
+    }
+    // released by the last debugger
+    EXPECT_EQ(PtDebugInfoCache::GetInstance()->GetFileCount(), filesBefore);
+}
+
+HWTEST_F_L0(DebuggerImplTest, SharedDebugInfoFileKeyTest)
+{
+    size_t scanCount = 0;
+    FileDebugInfo::EndLinesScanner scanner = [&scanCount]() {
+        scanCount++;
+        return FileDebugInfo::EndLines {{"entry/Index.ts", 10}}; // 10: end line
+    };
+    size_t filesBefore = PtDebugInfoCache::GetInstance()->GetFileCount();
+    std::shared_ptr<FileDebugInfo> loaded = PtDebugInfoCache::GetInstance()->Acquire({"modules.abc", 1});
+    EXPECT_EQ(PtDebugInfoCache::GetInstance()->Acquire({"modules.abc", 1}), loaded);
+    loaded->GetEndLine("entry/Index.ts", scanner);
+    loaded->GetEndLine("entry/Index.ts", scanner);
+    EXPECT_EQ(scanCount, 1U);
+    // a file updated in place is another file, its line tables are scanned again
+    std::shared_ptr<FileDebugInfo> updated = PtDebugInfoCache::GetInstance()->Acquire({"modules.abc", 2});
+    EXPECT_NE(updated, loaded);
+    EXPECT_EQ(updated->GetEndLine("entry/Index.ts", scanner), 10); // 10: end line
+    EXPECT_EQ(scanCount, 2U);
+    EXPECT_EQ(PtDebugInfoCache::GetInstance()->GetFileCount(), filesBefore + 2);
+    loaded.reset();
+    updated.reset();
+    EXPECT_EQ(PtDebugInfoCache::GetInstance()->GetFileCount(), filesBefore);
+}
+
+HWTEST_F_L0(DebuggerImplTest, SharedDebugInfoEndLineTest)
+{
+    size_t scanCount = 0;
+    FileDebugInfo::EndLinesScanner scanner = [&scanCount]() {
+        scanCount++;
+        return FileDebugInfo::EndLines {{"entry/Index.ts", 42}, {"entry/Util.ts", 7}}; // 42, 7: end lines
+    };
+    std::shared_ptr<FileDebugInfo> fileDebugInfo = PtDebugInfoCache::GetInstance()->Acquire({"modules.abc", 3});
+    EXPECT_EQ(fileDebugInfo->GetEndLine("entry/Index.ts", scanner), 42); // 42: end line
+    EXPECT_EQ(fileDebugInfo->GetEndLine("entry/Util.ts", scanner), 7); // 7: end line
+    // a source file without any line of code
+    EXPECT_EQ(fileDebugInfo->GetEndLine("entry/Empty.ts", scanner), 0);
+    // the line tables of the file are walked once for all its source files
+    EXPECT_EQ(scanCount, 1U);
+}
+
+HWTEST_F_L0(DebuggerImplTest, EnableBreakpointsCacheTest)
+{
+    std::string cachePath = "debugger_impl_breakpoints_cache_test.txt";
+    {
+        std::ofstream file(cachePath);
+        file << PtBreakpointCache::FILE_HEADER << '\n';
+        file << "1 10 1 100 4 entry/Index.ts\n"; // the locations of entry/Index.ts:10 in the abc of checksum 1
+    }
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    EXPECT_FALSE(testHelper.GetBreakpointsCache().IsEnabled());
+
+    auto enableParams = EnableParams::Create(*PtJson::Parse(
+        "{\"options\":[\"enableLaunchAccelerate\"],\"breakpointsCachePath\":\"" + cachePath + "\"}"));
+    ASSERT_NE(enableParams, nullptr);
+    UniqueDebuggerId id;
+    EXPECT_TRUE(debugger->Enable(*enableParams, &id).IsOk());
+    ecmaVm->GetJsDebuggerManager()->SetDebugMode(false);
+    EXPECT_TRUE(testHelper.GetBreakpointsCache().IsEnabled());
+    EXPECT_EQ(testHelper.GetBreakpointsCache().GetSize(), 1U);
+    EXPECT_NE(testHelper.GetBreakpointsCache().Find(1, "entry/Index.ts", 10), nullptr); // 1: checksum, 10: line
+    std::remove(cachePath.c_str());
+    if (mockProtocolChannel != nullptr) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, DestroyUnhooksRuntimeTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    debuggerImpl.reset();
+    // the runtime agent outlives the debugger agent, its getProperties must not call into the destroyed one
+    GetPropertiesParams params;
+    params.SetObjectId(1).SetOwnProperties(true);
+    std::vector<std::unique_ptr<PropertyDescriptor>> outPropertyDesc;
+    EXPECT_FALSE(runtimeImpl->GetProperties(params, &outPropertyDesc, {}, {}, {}).IsOk());
+    EXPECT_TRUE(outPropertyDesc.empty());
+    if (mockProtocolChannel != nullptr) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
+
+HWTEST_F_L0(DebuggerImplTest, EnableResetsAsyncStackTraceIdTest)
+{
+    MockProtocolChannel *mockProtocolChannel = new MockProtocolChannel();
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, mockProtocolChannel);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, mockProtocolChannel, runtimeImpl.get());
+    DebuggerImpl *debugger = debuggerImpl.get();
+    DebuggerImplFriendTest testHelper(debuggerImpl);
+    UniqueDebuggerId id;
+    auto params = EnableParams::Create(*PtJson::Parse(R"({"options":["enableAsyncStackTraceId"]})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->Enable(*params, &id).IsOk());
+    EXPECT_TRUE(testHelper.GetAsyncStackTraceId());
+    EXPECT_TRUE(debugger->Disable().IsOk());
+
+    // a frontend attaching again without the option gets the whole async stack in Debugger.paused
+    params = EnableParams::Create(*PtJson::Parse(R"({})"));
+    ASSERT_NE(params, nullptr);
+    EXPECT_TRUE(debugger->Enable(*params, &id).IsOk());
+    EXPECT_FALSE(testHelper.GetAsyncStackTraceId());
+    EXPECT_TRUE(debugger->Disable().IsOk());
+    if (mockProtocolChannel) {
+        delete mockProtocolChannel;
+        mockProtocolChannel = nullptr;
+    }
+}
 }  // namespace panda::test
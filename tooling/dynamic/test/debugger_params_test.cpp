@@ -206,6 +206,52 @@ HWTEST_F_L0(DebuggerParamsTest, DropFrameParamsCreateTest)
     EXPECT_EQ(objectData->GetDroppedDepth(), 3);
 }
 
+HWTEST_F_L0(DebuggerParamsTest, SetPausedCallFramesLimitParamsCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<SetPausedCallFramesLimitParams> objectData;
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{}})";
+    objectData = SetPausedCallFramesLimitParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"limit":"50"}})";
+    objectData = SetPausedCallFramesLimitParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"limit":50}})";
+    objectData = SetPausedCallFramesLimitParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetLimit(), 50U);
+}
+
+HWTEST_F_L0(DebuggerParamsTest, GetCallFramesParamsCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<GetCallFramesParams> objectData;
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"count":10}})";
+    objectData = GetCallFramesParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"start":50,"count":true}})";
+    objectData = GetCallFramesParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"start":50}})";
+    objectData = GetCallFramesParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetStart(), 50U);
+    EXPECT_FALSE(objectData->HasCount());
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"start":50,"count":10}})";
+    objectData = GetCallFramesParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetStart(), 50U);
+    ASSERT_TRUE(objectData->HasCount());
+    EXPECT_EQ(objectData->GetCount(), 10U);
+}
+
 HWTEST_F_L0(DebuggerParamsTest, EnableParamsCreateTest)
 {
     std::string msg;
@@ -222,6 +268,18 @@ HWTEST_F_L0(DebuggerParamsTest, EnableParamsCreateTest)
     enableParams = EnableParams::Create(DispatchRequest(msg).GetParams());
     ASSERT_NE(enableParams, nullptr);
     EXPECT_EQ(enableParams->GetMaxScriptsCacheSize(), 100);
+    EXPECT_FALSE(enableParams->HasBreakpointsCachePath());
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"breakpointsCachePath":10}})";
+    enableParams = EnableParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(enableParams, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test",
+        "params":{"breakpointsCachePath":"/data/storage/el2/base/cache/breakpoints"}})";
+    enableParams = EnableParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(enableParams, nullptr);
+    ASSERT_TRUE(enableParams->HasBreakpointsCachePath());
+    EXPECT_EQ(enableParams->GetBreakpointsCachePath(), "/data/storage/el2/base/cache/breakpoints");
 }
 
 HWTEST_F_L0(DebuggerParamsTest, EnableParamsAccelerateLaunchModeCreateTest)
@@ -782,6 +840,31 @@ HWTEST_F_L0(DebuggerParamsTest, GetScriptSourceParamsCreateTest)
     EXPECT_EQ(objectData->GetScriptId(), 10);
 }
 
+HWTEST_F_L0(DebuggerParamsTest, GetStackTraceParamsCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<GetStackTraceParams> objectData;
+
+    // abnormal params of null params.sub-key
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{}})";
+    objectData = GetStackTraceParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"stackTraceId":"10"}})";
+    objectData = GetStackTraceParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"stackTraceId":{"id":10}}})";
+    objectData = GetStackTraceParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"stackTraceId":{"id":"10"}}})";
+    objectData = GetStackTraceParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetStackTraceId()->GetId(), "10");
+    EXPECT_FALSE(objectData->GetStackTraceId()->HasDebuggerId());
+}
+
 HWTEST_F_L0(DebuggerParamsTest, RemoveBreakpointParamsCreateTest)
 {
     std::string msg;
@@ -918,6 +1001,31 @@ HWTEST_F_L0(DebuggerParamsTest, SetBlackboxPatternsParamsCreateTest)
     EXPECT_EQ(patterns.size(), 2U);
 }
 
+HWTEST_F_L0(DebuggerParamsTest, SetBlackboxedRangesParamsCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<SetBlackboxedRangesParams> objectData;
+
+    // abnormal params of null params.sub-key
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{}})";
+    objectData = SetBlackboxedRangesParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() +
+        R"({"id":0,"method":"Debugger.Test","params":{"scriptId":"1","positions":[{"lineNumber":1}]}})";
+    objectData = SetBlackboxedRangesParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"scriptId":"1","positions":[
+        {"lineNumber":1,"columnNumber":0},{"lineNumber":5,"columnNumber":2}]}})";
+    objectData = SetBlackboxedRangesParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetScriptId(), 1);
+    ASSERT_EQ(objectData->GetPositions()->size(), 2U);
+    EXPECT_EQ(objectData->GetPositions()->at(1)->GetLine(), 5);
+    EXPECT_EQ(objectData->GetPositions()->at(1)->GetColumn(), 2);
+}
+
 HWTEST_F_L0(DebuggerParamsTest, SetBreakpointByUrlParamsCreateTest)
 {
     std::string msg;
@@ -953,6 +1061,20 @@ HWTEST_F_L0(DebuggerParamsTest, SetBreakpointByUrlParamsCreateTest)
     EXPECT_EQ(objectData->GetScriptHash(), "testScriptHash");
     EXPECT_EQ(objectData->GetColumn(), 10);
     EXPECT_EQ(objectData->GetCondition(), "testCondition");
+    EXPECT_FALSE(objectData->HasLogMessage());
+    EXPECT_FALSE(objectData->HasHitCondition());
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"lineNumber":10, "url":"testURL",
+        "logMessage":10, "hitCondition":true}})";
+    objectData = SetBreakpointByUrlParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"lineNumber":10, "url":"testURL",
+        "logMessage":"i = {i}", "hitCondition":"%1000"}})";
+    objectData = SetBreakpointByUrlParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetLogMessage(), "i = {i}");
+    EXPECT_EQ(objectData->GetHitCondition(), "%1000");
 }
 
 HWTEST_F_L0(DebuggerParamsTest, SetPauseOnExceptionsParamsCreateTest)
@@ -983,6 +1105,32 @@ HWTEST_F_L0(DebuggerParamsTest, SetPauseOnExceptionsParamsCreateTest)
     objectData = SetPauseOnExceptionsParams::Create(DispatchRequest(msg).GetParams());
     ASSERT_NE(objectData, nullptr);
     EXPECT_EQ(objectData->GetState(), PauseOnExceptionsState::NONE);
+    EXPECT_TRUE(objectData->GetErrorNames().empty());
+    EXPECT_TRUE(objectData->GetUrlPatterns().empty());
+    EXPECT_EQ(objectData->GetThrowsPerPause(), 1U);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"state":"all","errorNames":"TypeError"}})";
+    objectData = SetPauseOnExceptionsParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"state":"all","urlPatterns":[10]}})";
+    objectData = SetPauseOnExceptionsParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"state":"all","throwsPerPause":0}})";
+    objectData = SetPauseOnExceptionsParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"state":"all",
+        "errorNames":["TypeError","RangeError"],"urlPatterns":["^entry/"],"throwsPerPause":100}})";
+    objectData = SetPauseOnExceptionsParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetState(), PauseOnExceptionsState::ALL);
+    ASSERT_EQ(objectData->GetErrorNames().size(), 2U);
+    EXPECT_EQ(objectData->GetErrorNames()[1], "RangeError");
+    ASSERT_EQ(objectData->GetUrlPatterns().size(), 1U);
+    EXPECT_EQ(objectData->GetUrlPatterns()[0], "^entry/");
+    EXPECT_EQ(objectData->GetThrowsPerPause(), 100U);
 }
 
 HWTEST_F_L0(DebuggerParamsTest, StepIntoParamsCreateTest)
@@ -1074,6 +1222,50 @@ HWTEST_F_L0(DebuggerParamsTest, GetPropertiesParamsCreateTest)
     ASSERT_TRUE(objectData->GetGeneratePreview());
 }
 
+HWTEST_F_L0(DebuggerParamsTest, ReleaseObjectParamsCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<ReleaseObjectParams> objectData;
+
+    // abnormal params of null params.sub-key
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{}})";
+    objectData = ReleaseObjectParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{"objectId":10}})";
+    objectData = ReleaseObjectParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{"objectId":"test"}})";
+    objectData = ReleaseObjectParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{"objectId":"10"}})";
+    objectData = ReleaseObjectParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetObjectId(), 10);
+}
+
+HWTEST_F_L0(DebuggerParamsTest, ReleaseObjectGroupParamsCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<ReleaseObjectGroupParams> objectData;
+
+    // abnormal params of null params.sub-key
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{}})";
+    objectData = ReleaseObjectGroupParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{"objectGroup":10}})";
+    objectData = ReleaseObjectGroupParams::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(objectData, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Runtime.Test","params":{"objectGroup":"backtrace"}})";
+    objectData = ReleaseObjectGroupParams::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(objectData, nullptr);
+    EXPECT_EQ(objectData->GetObjectGroup(), "backtrace");
+}
+
 HWTEST_F_L0(DebuggerParamsTest, CallFunctionOnParamsCreateTest)
 {
     std::string msg;
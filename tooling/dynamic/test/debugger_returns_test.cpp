@@ -143,6 +143,20 @@ HWTEST_F_L0(DebuggerReturnsTest, GetScriptSourceReturnsToJsonTest)
     EXPECT_EQ(bytecode, "bytecode_1");
 }
 
+HWTEST_F_L0(DebuggerReturnsTest, GetStackTraceReturnsToJsonTest)
+{
+    std::unique_ptr<StackTrace> stackTrace = std::make_unique<StackTrace>();
+    stackTrace->SetDescription("then");
+    std::unique_ptr<GetStackTraceReturns> getStackTraceReturns =
+        std::make_unique<GetStackTraceReturns>(std::move(stackTrace));
+
+    std::unique_ptr<PtJson> json;
+    ASSERT_EQ(getStackTraceReturns->ToJson()->GetObject("stackTrace", &json), Result::SUCCESS);
+    std::string description;
+    ASSERT_EQ(json->GetString("description", &description), Result::SUCCESS);
+    EXPECT_EQ(description, "then");
+}
+
 HWTEST_F_L0(DebuggerReturnsTest, RestartFrameReturnsToJsonTest)
 {
     auto callFrames = std::vector<std::unique_ptr<CallFrame>>();
@@ -166,6 +180,30 @@ HWTEST_F_L0(DebuggerReturnsTest, RestartFrameReturnsToJsonTest)
     EXPECT_EQ(json->GetSize(), 1);
 }
 
+HWTEST_F_L0(DebuggerReturnsTest, GetCallFramesReturnsToJsonTest)
+{
+    auto callFrames = std::vector<std::unique_ptr<CallFrame>>();
+    std::unique_ptr<CallFrame> callFrame = std::make_unique<CallFrame>();
+    std::unique_ptr<Location> location = std::make_unique<Location>();
+    location->SetScriptId(13).SetLine(16);
+    std::unique_ptr<RemoteObject> res = std::make_unique<RemoteObject>();
+    res->SetType("object");
+    callFrame->SetCallFrameId(100);
+    callFrame->SetLocation(std::move(location));
+    callFrame->SetThis(std::move(res));
+    callFrames.emplace_back(std::move(callFrame));
+    std::unique_ptr<GetCallFramesReturns> getCallFramesReturns =
+        std::make_unique<GetCallFramesReturns>(std::move(callFrames), true);
+
+    std::unique_ptr<PtJson> json;
+    ASSERT_EQ(getCallFramesReturns->ToJson()->GetArray("callFrames", &json), Result::SUCCESS);
+    ASSERT_NE(json, nullptr);
+    EXPECT_EQ(json->GetSize(), 1);
+    bool hasMore = false;
+    ASSERT_EQ(getCallFramesReturns->ToJson()->GetBool("hasMore", &hasMore), Result::SUCCESS);
+    EXPECT_TRUE(hasMore);
+}
+
 HWTEST_F_L0(DebuggerReturnsTest, SetBreakpointReturnsToJsonTest)
 {
     std::unique_ptr<Location> location = std::make_unique<Location>();
@@ -230,6 +268,13 @@ HWTEST_F_L0(DebuggerReturnsTest, GetPropertiesReturnsToJsonTest)
     ASSERT_EQ(getPropertiesReturns->ToJson()->GetArray("result", &json), Result::SUCCESS);
     ASSERT_NE(json, nullptr);
     EXPECT_EQ(json->GetSize(), 1);
+    bool hasMore = false;
+    EXPECT_EQ(getPropertiesReturns->ToJson()->GetBool("hasMore", &hasMore), Result::NOT_EXIST);
+
+    getPropertiesReturns = std::make_unique<GetPropertiesReturns>(std::vector<std::unique_ptr<PropertyDescriptor>>(),
+        std::nullopt, std::nullopt, std::nullopt, true);
+    ASSERT_EQ(getPropertiesReturns->ToJson()->GetBool("hasMore", &hasMore), Result::SUCCESS);
+    EXPECT_TRUE(hasMore);
 }
 
 HWTEST_F_L0(DebuggerReturnsTest, CallFunctionOnReturnsToJsonTest)
@@ -132,6 +132,28 @@ HWTEST_F_L0(DebuggerServiceTest, ProcessMessageTest)
     ASSERT_TRUE(result.find("Stop is failure") != std::string::npos);
 }
 
+HWTEST_F_L0(DebuggerServiceTest, SetAsyncSendEnabledTest)
+{
+    SetAsyncSendEnabled(ecmaVm, true);
+    ASSERT_TRUE(ecmaVm->GetJsDebuggerManager()->GetDebuggerHandler() == nullptr);
+    std::string result = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&result]([[maybe_unused]] const void *ptr, const std::string &temp) { result = temp; };
+    InitializeDebugger(ecmaVm, callback);
+    ProtocolHandler *handler = ecmaVm->GetJsDebuggerManager()->GetDebuggerHandler();
+    ASSERT_FALSE(handler->IsAsyncSendEnabled());
+    SetAsyncSendEnabled(ecmaVm, true);
+    ASSERT_TRUE(handler->IsAsyncSendEnabled());
+    std::string msg = std::string() + R"({"id":0,"method":"Tracing.Test","params":{}})";
+    OnMessage(ecmaVm, msg + "");
+    ProcessMessage(ecmaVm);
+    // disabling flushes the pending replies
+    SetAsyncSendEnabled(ecmaVm, false);
+    ASSERT_FALSE(handler->IsAsyncSendEnabled());
+    ASSERT_TRUE(result.find("Unknown method: Test") != std::string::npos);
+    UninitializeDebugger(ecmaVm);
+}
+
 HWTEST_F_L0(DebuggerServiceTest, GetDispatchStatusTest)
 {
     ProtocolHandler::DispatchStatus status = ProtocolHandler::DispatchStatus(GetDispatchStatus(ecmaVm));
@@ -2755,6 +2755,71 @@ HWTEST_F_L0(DebuggerTypesTest, CallArgumentToJsonTest)
     ASSERT_TRUE(ret != nullptr);
 }
 
+HWTEST_F_L0(DebuggerTypesTest, StackTraceIdCreateTest)
+{
+    std::string msg;
+    std::unique_ptr<StackTraceId> stackTraceId;
+
+    // abnormal params of null params.sub-key
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{}})";
+    stackTraceId = StackTraceId::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(stackTraceId, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"id":"3","debuggerId":0}})";
+    stackTraceId = StackTraceId::Create(DispatchRequest(msg).GetParams());
+    EXPECT_EQ(stackTraceId, nullptr);
+
+    msg = std::string() + R"({"id":0,"method":"Debugger.Test","params":{"id":"3","debuggerId":"1"}})";
+    stackTraceId = StackTraceId::Create(DispatchRequest(msg).GetParams());
+    ASSERT_NE(stackTraceId, nullptr);
+    EXPECT_EQ(stackTraceId->GetId(), "3");
+    ASSERT_TRUE(stackTraceId->HasDebuggerId());
+    EXPECT_EQ(stackTraceId->GetDebuggerId(), "1");
+
+    std::string tmpStr;
+    std::unique_ptr<PtJson> json = stackTraceId->ToJson();
+    ASSERT_EQ(json->GetString("id", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ(tmpStr, "3");
+    ASSERT_EQ(json->GetString("debuggerId", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ(tmpStr, "1");
+}
+
+HWTEST_F_L0(DebuggerTypesTest, StackTraceToJsonTest)
+{
+    std::shared_ptr<StackFrame> stackFrame = std::make_shared<StackFrame>();
+    stackFrame->SetFunctionName("step");
+    stackFrame->SetScriptId(2);
+    stackFrame->SetUrl("async_chain.js");
+    stackFrame->SetLineNumber(17);
+    stackFrame->SetColumnNumber(4);
+    StackTrace stackTrace;
+    stackTrace.SetDescription("then").SetCallFrames({stackFrame});
+
+    std::string tmpStr;
+    int32_t tmpInt;
+    std::unique_ptr<PtJson> json = stackTrace.ToJson();
+    ASSERT_EQ(json->GetString("description", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ(tmpStr, "then");
+    std::unique_ptr<PtJson> callFrames;
+    ASSERT_EQ(json->GetArray("callFrames", &callFrames), Result::SUCCESS);
+    ASSERT_EQ(callFrames->GetSize(), 1);
+    std::unique_ptr<PtJson> callFrame = callFrames->Get(0);
+    ASSERT_EQ(callFrame->GetString("functionName", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ(tmpStr, "step");
+    ASSERT_EQ(callFrame->GetInt("lineNumber", &tmpInt), Result::SUCCESS);
+    EXPECT_EQ(tmpInt, 17);
+    std::unique_ptr<PtJson> parentId;
+    EXPECT_EQ(json->GetObject("parentId", &parentId), Result::NOT_EXIST);
+
+    std::unique_ptr<StackTraceId> stackTraceId = std::make_unique<StackTraceId>();
+    stackTraceId->SetId("5");
+    stackTrace.SetParentId(std::move(stackTraceId));
+    json = stackTrace.ToJson();
+    ASSERT_EQ(json->GetObject("parentId", &parentId), Result::SUCCESS);
+    ASSERT_EQ(parentId->GetString("id", &tmpStr), Result::SUCCESS);
+    EXPECT_EQ(tmpStr, "5");
+}
+
 HWTEST_F_L0(DebuggerTypesTest, ScriptPositionCreateTest)
 {
     std::string msg;
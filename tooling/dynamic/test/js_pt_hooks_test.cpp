@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <chrono>
+
 #include "agent/debugger_impl.h"
 #include "backend/js_pt_hooks.h"
 #include "tooling/dynamic/base/pt_types.h"
@@ -24,6 +26,7 @@
 #include "ecmascript/js_tagged_value_wrapper-inl.h"
 #include "ecmascript/object_factory.h"
 #include "ecmascript/tests/test_helper.h"
+#include "debugger_service.h"
 #include "protocol_handler.h"
 
 using namespace panda::ecmascript;
@@ -154,4 +157,43 @@ HWTEST_F_L0(JSPtHooksTest, SetDebuggerAccessorTest)
     EXPECT_TRUE(globalObj->Has(ecmaVm, setStr));
     EXPECT_TRUE(globalObj->Has(ecmaVm, getStr));
 }
+
+HWTEST_F_L0(JSPtHooksTest, SingleStepIdleBenchmark)
+{
+    std::string outStrForCallbackCheck = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&outStrForCallbackCheck]([[maybe_unused]] const void *ptr, const std::string &inStrOfReply) {
+            outStrForCallbackCheck = inStrOfReply;};
+    InitializeDebugger(ecmaVm, callback);
+    ProtocolHandler *handler = ecmaVm->GetJsDebuggerManager()->GetDebuggerHandler();
+    ASSERT_NE(handler, nullptr);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, handler);
+    auto debuggerImpl = std::make_unique<DebuggerImpl>(ecmaVm, handler, runtimeImpl.get());
+    std::unique_ptr<JSPtHooks> jspthooks = std::make_unique<JSPtHooks>(debuggerImpl.get());
+    jspthooks->DisableFirstTimeFlag();
+    JSPtLocation location(nullptr, EntityId(0), 0);
+
+    // attached, but no step, pause or request pending
+    constexpr uint32_t stepCount = 10000000;
+    uint32_t pausedCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < stepCount; i++) {
+        if (jspthooks->SingleStep(location)) {
+            pausedCount++;
+        }
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << "idle single step: "
+                     << std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / stepCount
+                     << "ns per bytecode";
+    EXPECT_EQ(pausedCount, 0U);
+    EXPECT_TRUE(outStrForCallbackCheck.empty());
+    EXPECT_FALSE(debuggerImpl->IsStepping());
+
+    // a request queued meanwhile is handled on the next bytecode
+    handler->DispatchCommand(R"({"id":0,"method":"Debugger.setSkipAllPauses","params":{"skip":true}})");
+    EXPECT_FALSE(jspthooks->SingleStep(location));
+    EXPECT_STREQ(outStrForCallbackCheck.c_str(), R"({"id":0,"result":{}})");
+    UninitializeDebugger(ecmaVm);
+}
 }
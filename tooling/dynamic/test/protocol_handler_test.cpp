@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <chrono>
+
 #include "ecmascript/tests/test_helper.h"
 #include "protocol_handler.h"
 
@@ -107,4 +109,169 @@ HWTEST_F_L0(ProtocolHandlerTest, SendResponseTest)
     protocol->SendResponse(request, response1, returns);
     ASSERT_TRUE(result == "{\"id\":0,\"result\":{}}");
 }
+
+HWTEST_F_L0(ProtocolHandlerTest, GetRequestPriorityTest)
+{
+    DispatchRequest pause(R"({"id":0,"method":"Debugger.pause","params":{}})");
+    ASSERT_EQ(ProtocolHandler::GetRequestPriority(pause), ProtocolHandler::RequestPriority::ORDERED);
+    DispatchRequest stepOver(R"({"id":0,"method":"Debugger.stepOver","params":{}})");
+    ASSERT_EQ(ProtocolHandler::GetRequestPriority(stepOver), ProtocolHandler::RequestPriority::ORDERED);
+    DispatchRequest evaluate(R"({"id":0,"method":"Debugger.evaluateOnCallFrame","params":{}})");
+    ASSERT_EQ(ProtocolHandler::GetRequestPriority(evaluate), ProtocolHandler::RequestPriority::ORDERED);
+    DispatchRequest snapshot(R"({"id":0,"method":"HeapProfiler.takeHeapSnapshot","params":{}})");
+    ASSERT_EQ(ProtocolHandler::GetRequestPriority(snapshot), ProtocolHandler::RequestPriority::BULK);
+    DispatchRequest invalid("invalid json");
+    ASSERT_EQ(ProtocolHandler::GetRequestPriority(invalid), ProtocolHandler::RequestPriority::ORDERED);
+}
+
+HWTEST_F_L0(ProtocolHandlerTest, ProcessCommandPriorityTest)
+{
+    std::vector<int32_t> replyIds;
+    std::function<void(const void*, const std::string &)> callback =
+        [&replyIds]([[maybe_unused]] const void *ptr, const std::string &temp) {
+            std::unique_ptr<PtJson> json = PtJson::Parse(temp);
+            int32_t id = -1;
+            if (json != nullptr && json->GetInt("id", &id) == Result::SUCCESS) {
+                replyIds.push_back(id);
+            }
+            if (json != nullptr) {
+                json->ReleaseRoot();
+            }
+        };
+    auto protocol = std::make_unique<ProtocolHandler>(callback, ecmaVm);
+    // bulk requests are overtaken by the requests of other domains only,
+    // the requests of a domain should keep their arrival order
+    protocol->DispatchCommand(R"({"id":1,"method":"Debugger.getPossibleBreakpoints","params":{}})");
+    protocol->DispatchCommand(R"({"id":2,"method":"Runtime.getHeapUsage","params":{}})");
+    protocol->DispatchCommand(R"({"id":3,"method":"Debugger.pause","params":{}})");
+    protocol->DispatchCommand(R"({"id":4,"method":"Runtime.getHeapUsage","params":{}})");
+    protocol->DispatchCommand(R"({"id":5,"method":"Debugger.getPossibleBreakpoints","params":{}})");
+    protocol->DispatchCommand(R"({"id":6,"method":"Runtime.getHeapUsage","params":{}})");
+    protocol->ProcessCommand();
+    std::vector<int32_t> expectIds {2, 4, 6, 1, 3, 5};
+    ASSERT_EQ(replyIds, expectIds);
+}
+
+HWTEST_F_L0(ProtocolHandlerTest, ProcessCommandGetPropertiesBeforeResumeTest)
+{
+    std::vector<int32_t> replyIds;
+    std::function<void(const void*, const std::string &)> callback =
+        [&replyIds]([[maybe_unused]] const void *ptr, const std::string &temp) {
+            std::unique_ptr<PtJson> json = PtJson::Parse(temp);
+            int32_t id = -1;
+            if (json != nullptr && json->GetInt("id", &id) == Result::SUCCESS) {
+                replyIds.push_back(id);
+            }
+            if (json != nullptr) {
+                json->ReleaseRoot();
+            }
+        };
+    auto protocol = std::make_unique<ProtocolHandler>(callback, ecmaVm);
+    // the object of getProperties is only valid while paused, it must not be overtaken by resume
+    protocol->DispatchCommand(R"({"id":1,"method":"Runtime.getProperties","params":{"objectId":"1"}})");
+    protocol->DispatchCommand(R"({"id":2,"method":"Debugger.evaluateOnCallFrame",
+        "params":{"callFrameId":"0","expression":"a"}})");
+    protocol->DispatchCommand(R"({"id":3,"method":"Debugger.resume","params":{}})");
+    protocol->ProcessCommand();
+    std::vector<int32_t> expectIds {1, 2, 3};
+    ASSERT_EQ(replyIds, expectIds);
+}
+
+HWTEST_F_L0(ProtocolHandlerTest, CancelPendingRequestsTest)
+{
+    std::vector<std::string> results;
+    std::function<void(const void*, const std::string &)> callback =
+        [&results]([[maybe_unused]] const void *ptr, const std::string &temp) { results.push_back(temp); };
+    auto protocol = std::make_unique<ProtocolHandler>(callback, ecmaVm);
+    protocol->DispatchCommand(R"({"id":1,"method":"Runtime.getHeapUsage","params":{}})");
+    protocol->DispatchCommand(R"({"id":2,"method":"Debugger.getPossibleBreakpoints","params":{}})");
+    ASSERT_EQ(protocol->CancelPendingRequests(), 2U);
+    ASSERT_EQ(protocol->GetDispatchStatus(), ProtocolHandler::DispatchStatus::DISPATCHED);
+    protocol->ProcessCommand();
+    ASSERT_TRUE(results.empty());
+
+    // client disconnect drops the requests queued before it, only itself is dispatched
+    protocol->DispatchCommand(R"({"id":3,"method":"Runtime.getHeapUsage","params":{}})");
+    protocol->DispatchCommand(R"({"id":4,"method":"Debugger.getPossibleBreakpoints","params":{}})");
+    protocol->DispatchCommand(R"({"id":0,"method":"Debugger.clientDisconnect","params":{}})");
+    protocol->ProcessCommand();
+    ASSERT_TRUE(results.empty());
+    ASSERT_EQ(protocol->CancelPendingRequests(), 0U);
+}
+
+HWTEST_F_L0(ProtocolHandlerTest, AsyncSendKeepOrderTest)
+{
+    std::vector<std::string> syncResults;
+    std::vector<std::string> asyncResults;
+    std::thread::id sendThreadId;
+    std::function<void(const void*, const std::string &)> syncCallback =
+        [&syncResults]([[maybe_unused]] const void *ptr, const std::string &temp) { syncResults.push_back(temp); };
+    std::function<void(const void*, const std::string &)> asyncCallback =
+        [&asyncResults, &sendThreadId]([[maybe_unused]] const void *ptr, const std::string &temp) {
+            sendThreadId = std::this_thread::get_id();
+            asyncResults.push_back(temp);
+        };
+    auto syncProtocol = std::make_unique<ProtocolHandler>(syncCallback, ecmaVm);
+    auto asyncProtocol = std::make_unique<ProtocolHandler>(asyncCallback, ecmaVm);
+    asyncProtocol->SetAsyncSendEnabled(true);
+    ASSERT_TRUE(asyncProtocol->IsAsyncSendEnabled());
+    PtBaseReturns returns;
+    for (int32_t i = 0; i < 1000; i++) {
+        std::string msg = R"({"id":)" + std::to_string(i) + R"(,"method":"Tracing.Test","params":{}})";
+        DispatchRequest request(msg);
+        DispatchResponse response = (i % 2 == 0) ? DispatchResponse::Ok() : DispatchResponse::Fail("error");
+        syncProtocol->SendResponse(request, response, returns);
+        asyncProtocol->SendResponse(request, response, returns);
+    }
+    // disabling flushes all the pending replies
+    asyncProtocol->SetAsyncSendEnabled(false);
+    ASSERT_FALSE(asyncProtocol->IsAsyncSendEnabled());
+    ASSERT_NE(sendThreadId, std::this_thread::get_id());
+    ASSERT_EQ(syncResults, asyncResults);
+
+    // replies are sent synchronously again after disabled
+    DispatchRequest request(R"({"id":0,"method":"Tracing.Test","params":{}})");
+    asyncProtocol->SendResponse(request, DispatchResponse::Ok(), returns);
+    ASSERT_EQ(sendThreadId, std::this_thread::get_id());
+}
+
+HWTEST_F_L0(ProtocolHandlerTest, AsyncSendHeapSnapshotStallBenchmark)
+{
+#if defined(ECMASCRIPT_SUPPORT_HEAPPROFILER)
+    // simulate a slow transport, each write to the socket takes some time
+    constexpr auto writeCost = std::chrono::microseconds(100);
+    std::string msg = R"({"id":1,"method":"HeapProfiler.takeHeapSnapshot","params":{
+        "reportProgress":true,
+        "treatGlobalObjectsAsRoots":true,
+        "captureNumericValue":true}})";
+    auto runSnapshot = [this, &msg, &writeCost](bool asyncSend, size_t &replyCount, std::string &lastReply) {
+        std::function<void(const void*, const std::string &)> callback =
+            [&replyCount, &lastReply, &writeCost]([[maybe_unused]] const void *ptr, const std::string &temp) {
+                std::this_thread::sleep_for(writeCost);
+                replyCount++;
+                lastReply = temp;
+            };
+        auto protocol = std::make_unique<ProtocolHandler>(callback, ecmaVm);
+        protocol->SetAsyncSendEnabled(asyncSend);
+        protocol->DispatchCommand(msg + "");
+        auto start = std::chrono::steady_clock::now();
+        protocol->ProcessCommand();
+        auto stall = std::chrono::steady_clock::now() - start;
+        protocol->SetAsyncSendEnabled(false);
+        return std::chrono::duration_cast<std::chrono::microseconds>(stall).count();
+    };
+    size_t syncCount = 0;
+    size_t asyncCount = 0;
+    std::string syncLastReply;
+    std::string asyncLastReply;
+    auto syncStall = runSnapshot(false, syncCount, syncLastReply);
+    auto asyncStall = runSnapshot(true, asyncCount, asyncLastReply);
+    GTEST_LOG_(INFO) << "js thread stall of takeHeapSnapshot, sync send: " << syncStall << "us for "
+                     << syncCount << " replies, async send: " << asyncStall << "us for " << asyncCount << " replies";
+    // the response is always sent after all the snapshot chunks
+    ASSERT_EQ(syncLastReply, "{\"id\":1,\"result\":{}}");
+    ASSERT_EQ(asyncLastReply, "{\"id\":1,\"result\":{}}");
+    ASSERT_GT(asyncCount, 1U);
+#endif
+}
 }  // namespace panda::test
\ No newline at end of file
@@ -13,6 +13,9 @@
  * limitations under the License.
  */
 
+#include <chrono>
+#include <random>
+
 #include "ecmascript/tests/test_helper.h"
 #include "tooling/dynamic/base/pt_base64.h"
 
@@ -311,4 +314,82 @@ HWTEST_F_L0(PtBase64Test, EncodeAndDecodeInvalidCharacters)
         EXPECT_FALSE(done);
     }
 }
-}
\ No newline at end of file
+
+HWTEST_F_L0(PtBase64Test, EncodeAndDecodeRandomEquivalence)
+{
+    const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::mt19937 random(0);
+    for (int count = 0; count < 10000; count++) {
+        size_t size = random() % 512; // 512: cover several simd blocks and all the tails
+        std::string src(size, '\0');
+        for (auto &ch : src) {
+            ch = static_cast<char>(random());
+        }
+        std::string encoded(PtBase64::EncodedSize(size), '\0');
+        std::string encodedScalar(PtBase64::EncodedSize(size), '\0');
+        size_t len = PtBase64::Encode(encoded.data(), src.data(), size);
+        size_t lenScalar = PtBase64::EncodeScalar(encodedScalar.data(), src.data(), size);
+        ASSERT_EQ(len, lenScalar);
+        ASSERT_EQ(encoded, encodedScalar);
+
+        // corrupt some of the inputs with padding, invalid or non-ascii chars at random positions
+        bool corrupted = !encoded.empty() && random() % 2 == 0;
+        if (corrupted) {
+            size_t pos = random() % encoded.size();
+            switch (random() % 3) { // 3: kinds of corruption
+                case 0:
+                    encoded[pos] = '=';
+                    break;
+                case 1:
+                    encoded[pos] = static_cast<char>(random());
+                    break;
+                default:
+                    encoded[pos] = alphabet[random() % alphabet.size()];
+                    break;
+            }
+        }
+        std::string decoded(PtBase64::DecodedSize(encoded.size()), '\0');
+        std::string decodedScalar(PtBase64::DecodedSize(encoded.size()), '\0');
+        auto [numOctets, done] = PtBase64::Decode(decoded.data(), encoded.data(), encoded.size());
+        auto [numOctetsScalar, doneScalar] =
+            PtBase64::DecodeScalar(decodedScalar.data(), encoded.data(), encoded.size());
+        ASSERT_EQ(numOctets, numOctetsScalar);
+        ASSERT_EQ(done, doneScalar);
+        decoded.resize(numOctets);
+        decodedScalar.resize(numOctetsScalar);
+        ASSERT_EQ(decoded, decodedScalar);
+        if (!corrupted && size != 0) {
+            ASSERT_TRUE(done);
+            ASSERT_EQ(decoded, src);
+        }
+    }
+}
+
+HWTEST_F_L0(PtBase64Test, EncodeAndDecodeThroughputBenchmark)
+{
+    constexpr size_t size = 8 * 1024 * 1024; // 8MB: a large bytecode buffer or profile
+    std::mt19937 random(0);
+    std::string src(size, '\0');
+    for (auto &ch : src) {
+        ch = static_cast<char>(random());
+    }
+    std::string encoded(PtBase64::EncodedSize(size), '\0');
+    std::string decoded(PtBase64::DecodedSize(encoded.size()), '\0');
+    auto measure = [](auto &&func) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto encodeScalarTime = measure([&] { PtBase64::EncodeScalar(encoded.data(), src.data(), size); });
+    auto encodeTime = measure([&] { PtBase64::Encode(encoded.data(), src.data(), size); });
+    auto decodeScalarTime = measure([&] { PtBase64::DecodeScalar(decoded.data(), encoded.data(), encoded.size()); });
+    std::pair<std::size_t, bool> result;
+    auto decodeTime = measure([&] { result = PtBase64::Decode(decoded.data(), encoded.data(), encoded.size()); });
+    GTEST_LOG_(INFO) << "base64 of 8MB, encode: " << encodeTime << "us (scalar " << encodeScalarTime
+                     << "us), decode: " << decodeTime << "us (scalar " << decodeScalarTime << "us)";
+    EXPECT_EQ(result.first, size);
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(decoded, src);
+}
+}
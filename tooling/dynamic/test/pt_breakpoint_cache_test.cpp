@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "tooling/dynamic/base/pt_breakpoint_cache.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::tooling;
+
+namespace panda::test {
+class PtBreakpointCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        std::remove(cachePath_.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(cachePath_.c_str());
+    }
+
+protected:
+    size_t CountLines()
+    {
+        std::ifstream file(cachePath_);
+        size_t count = 0;
+        std::string line;
+        while (std::getline(file, line)) {
+            count++;
+        }
+        return count;
+    }
+
+    std::string cachePath_ {"pt_breakpoint_cache_test.txt"};
+};
+
+HWTEST_F_L0(PtBreakpointCacheTest, DisabledTest)
+{
+    PtBreakpointCache cache;
+    EXPECT_FALSE(cache.IsEnabled());
+    cache.Insert(1, "entry/Index.ts", 10, {{100, 4}}); // 1: checksum, 10: line, 100: method, 4: offset
+    // nothing is written without a file
+    EXPECT_TRUE(cache.Flush());
+    EXPECT_EQ(CountLines(), 0U);
+}
+
+HWTEST_F_L0(PtBreakpointCacheTest, HitAndMissTest)
+{
+    constexpr uint32_t checksum = 0x1234abcd;
+    PtBreakpointCache cache;
+    // the first launch has no file yet
+    EXPECT_TRUE(cache.Load(cachePath_));
+    EXPECT_TRUE(cache.IsEnabled());
+    EXPECT_EQ(cache.GetSize(), 0U);
+    EXPECT_EQ(cache.Find(checksum, "entry/Index.ts", 10), nullptr); // 10: line
+
+    // a line of a method called from two places resolves to two locations, the url may contain spaces
+    cache.Insert(checksum, "entry/Index.ts", 10, {{100, 4}, {120, 16}}); // 10: line, 100 120: methods
+    cache.Insert(checksum, "entry/My Page.ts", 3, {{200, 0}}); // 3: line, 200: method
+    EXPECT_TRUE(cache.Flush());
+    EXPECT_EQ(CountLines(), 3U); // 3: the header and an entry per breakpoint
+
+    // a later launch of the same abc finds the locations
+    PtBreakpointCache launched;
+    EXPECT_TRUE(launched.Load(cachePath_));
+    EXPECT_EQ(launched.GetSize(), 2U);
+    const auto *locations = launched.Find(checksum, "entry/Index.ts", 10); // 10: line
+    ASSERT_NE(locations, nullptr);
+    ASSERT_EQ(locations->size(), 2U);
+    EXPECT_EQ(locations->at(0).methodId, 100U);
+    EXPECT_EQ(locations->at(0).offset, 4U);
+    EXPECT_EQ(locations->at(1).methodId, 120U);
+    EXPECT_EQ(locations->at(1).offset, 16U);
+    locations = launched.Find(checksum, "entry/My Page.ts", 3); // 3: line
+    ASSERT_NE(locations, nullptr);
+    ASSERT_EQ(locations->size(), 1U);
+    EXPECT_EQ(locations->at(0).methodId, 200U);
+
+    // another line or url is not resolved yet
+    EXPECT_EQ(launched.Find(checksum, "entry/Index.ts", 11), nullptr); // 11: line
+    EXPECT_EQ(launched.Find(checksum, "entry/Util.ts", 10), nullptr); // 10: line
+}
+
+HWTEST_F_L0(PtBreakpointCacheTest, ChecksumChangedTest)
+{
+    constexpr uint32_t checksum = 0x1234abcd;
+    constexpr uint32_t rebuiltChecksum = 0x5678ef01;
+    PtBreakpointCache cache;
+    EXPECT_TRUE(cache.Load(cachePath_));
+    cache.Insert(checksum, "entry/Index.ts", 10, {{100, 4}}); // 10: line, 100: method, 4: offset
+    EXPECT_TRUE(cache.Flush());
+
+    // the rebuilt abc may have moved the method, the entry is resolved again and replaced
+    PtBreakpointCache launched;
+    EXPECT_TRUE(launched.Load(cachePath_));
+    EXPECT_EQ(launched.Find(rebuiltChecksum, "entry/Index.ts", 10), nullptr); // 10: line
+    launched.Insert(rebuiltChecksum, "entry/Index.ts", 10, {{300, 8}}); // 10: line, 300: method, 8: offset
+    EXPECT_TRUE(launched.Flush());
+    EXPECT_EQ(launched.Find(checksum, "entry/Index.ts", 10), nullptr); // 10: line
+    EXPECT_EQ(CountLines(), 3U); // 3: the header and both entries
+
+    // the replaced line is dropped when the file is loaded again
+    PtBreakpointCache relaunched;
+    EXPECT_TRUE(relaunched.Load(cachePath_));
+    EXPECT_EQ(CountLines(), 2U); // 2: the header and the entry
+    EXPECT_EQ(relaunched.Find(checksum, "entry/Index.ts", 10), nullptr); // 10: line
+    const auto *locations = relaunched.Find(rebuiltChecksum, "entry/Index.ts", 10); // 10: line
+    ASSERT_NE(locations, nullptr);
+    ASSERT_EQ(locations->size(), 1U);
+    EXPECT_EQ(locations->at(0).methodId, 300U);
+    EXPECT_EQ(locations->at(0).offset, 8U);
+}
+
+HWTEST_F_L0(PtBreakpointCacheTest, MalformedFileTest)
+{
+    // a count larger than the locations, a missing url, a line cut by a crash and a line of another format
+    for (const char *malformed : {"1 11 3 100 4 entry/Index.ts", "1 12 1 100 4", "1 13 1 10", "not a cache line"}) {
+        {
+            std::ofstream file(cachePath_);
+            file << PtBreakpointCache::FILE_HEADER << '\n';
+            file << "1 10 1 100 4 entry/Index.ts\n";
+            file << "1 10 1 100 8 entry/Index.ts\n";
+            file << malformed << '\n';
+        }
+        // the file is left as it is, even though an entry is replaced, and the cache is not used
+        PtBreakpointCache cache;
+        EXPECT_FALSE(cache.Load(cachePath_));
+        EXPECT_FALSE(cache.IsEnabled());
+        EXPECT_EQ(cache.GetSize(), 0U);
+        EXPECT_EQ(cache.Find(1, "entry/Index.ts", 10), nullptr); // 1: checksum, 10: line
+        cache.Insert(1, "entry/Index.ts", 11, {{100, 4}}); // 1: checksum, 11: line, 100: method, 4: offset
+        EXPECT_TRUE(cache.Flush());
+        EXPECT_EQ(CountLines(), 4U); // 4: the lines written above
+    }
+}
+
+HWTEST_F_L0(PtBreakpointCacheTest, ForeignFileTest)
+{
+    // the path comes from the frontend, it may name any file of the app
+    {
+        std::ofstream file(cachePath_);
+        file << "1 10 1 100 4 entry/Index.ts\n";
+        file << "{\"user\":\"data\"}\n";
+    }
+    PtBreakpointCache cache;
+    EXPECT_FALSE(cache.Load(cachePath_));
+    EXPECT_FALSE(cache.IsEnabled());
+    cache.Insert(1, "entry/Index.ts", 10, {{100, 4}}); // 1: checksum, 10: line, 100: method, 4: offset
+    EXPECT_TRUE(cache.Flush());
+    EXPECT_EQ(CountLines(), 2U); // 2: the lines written above
+
+    // an empty file is not a cache file either
+    {
+        std::ofstream file(cachePath_);
+    }
+    EXPECT_FALSE(cache.Load(cachePath_));
+    EXPECT_FALSE(cache.IsEnabled());
+    EXPECT_EQ(CountLines(), 0U);
+
+    // a directory is not opened as a file
+    EXPECT_FALSE(cache.Load("."));
+    EXPECT_FALSE(cache.IsEnabled());
+}
+}  // namespace panda::test
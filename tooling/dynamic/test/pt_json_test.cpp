@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <chrono>
+
 #include "ecmascript/tests/test_helper.h"
 #include "tooling/dynamic/base/pt_json.h"
 
@@ -324,4 +326,87 @@ HWTEST_F_L0(PtJsonTest, GetKeysArraytest)
     EXPECT_TRUE(keys.at(0) == "a");
     EXPECT_TRUE(keys.at(1) == "b");
 }
-}
\ No newline at end of file
+
+HWTEST_F_L0(PtJsonTest, EscapeStringTest)
+{
+    std::string str = std::string("a\"b\\c\b\f\n\r\td") + '\x01' + '\x1f' + "\x7f\xe4\xb8\xad";
+    std::string result;
+    PtJson::EscapeString(str.data(), str.size(), result);
+    EXPECT_EQ(result, "\"a\\\"b\\\\c\\b\\f\\n\\r\\td\\u0001\\u001f\x7f\xe4\xb8\xad\"");
+
+    result.clear();
+    PtJson::EscapeString("", 0, result);
+    EXPECT_EQ(result, "\"\"");
+}
+
+HWTEST_F_L0(PtJsonTest, LargeStringRoundTripTest)
+{
+    // every char except '\0', in runs crossing the simd blocks
+    std::string source;
+    for (int i = 0; i < 64; i++) {
+        for (int ch = 1; ch < 256; ch++) {
+            source.append(i % 17 + 1, static_cast<char>(ch)); // 17: vary the length of the runs
+        }
+    }
+    std::unique_ptr<PtJson> json = PtJson::CreateObject();
+    json->Add("scriptSource", source.c_str());
+    json->Add("short", "a\"b\n");
+    std::unique_ptr<PtJson> array = PtJson::CreateArray();
+    array->Push(source.c_str());
+    array->Push(100);
+    json->Add("array", array);
+
+    // the same as the escaping of cJSON
+    std::string str = json->Stringify();
+    char *expected = cJSON_PrintUnformatted(json->GetJson());
+    ASSERT_NE(expected, nullptr);
+    EXPECT_EQ(str, expected);
+    cJSON_free(expected);
+    // the nodes are restored after stringify
+    std::string value;
+    ASSERT_EQ(json->GetString("scriptSource", &value), Result::SUCCESS);
+    EXPECT_EQ(value, source);
+
+    std::unique_ptr<PtJson> parsed = PtJson::Parse(str);
+    ASSERT_EQ(parsed->GetString("scriptSource", &value), Result::SUCCESS);
+    EXPECT_EQ(value, source);
+    std::unique_ptr<PtJson> parsedArray;
+    ASSERT_EQ(parsed->GetArray("array", &parsedArray), Result::SUCCESS);
+    EXPECT_EQ(parsedArray->Get(0)->GetString(), source);
+    EXPECT_EQ(parsed->Stringify(), str);
+    parsed->ReleaseRoot();
+    json->ReleaseRoot();
+
+    std::unique_ptr<PtJson> root = PtJson::Parse("\"" + std::string(1024, 'a') + "\\n\"");
+    ASSERT_TRUE(root->IsString());
+    EXPECT_EQ(root->Stringify(), "\"" + std::string(1024, 'a') + "\\n\"");
+    root->ReleaseRoot();
+}
+
+HWTEST_F_L0(PtJsonTest, LargeScriptSourceBenchmark)
+{
+    // 4MB of source code with a few chars to escape in every line
+    std::string line = "    let message = \"value:\\t\" + obj.value; // comment\n";
+    std::string source;
+    while (source.size() < 4 * 1024 * 1024) {
+        source += line;
+    }
+    std::unique_ptr<PtJson> json = PtJson::CreateObject();
+    json->Add("scriptSource", source.c_str());
+
+    auto start = std::chrono::steady_clock::now();
+    char *expected = cJSON_PrintUnformatted(json->GetJson());
+    auto cJsonTime = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+    std::string str = json->Stringify();
+    auto stringifyTime = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << "stringify 4MB script source: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(stringifyTime).count()
+                     << "us, cJSON: " << std::chrono::duration_cast<std::chrono::microseconds>(cJsonTime).count()
+                     << "us";
+    ASSERT_NE(expected, nullptr);
+    EXPECT_EQ(str, expected);
+    cJSON_free(expected);
+    json->ReleaseRoot();
+}
+}
@@ -152,4 +152,59 @@ HWTEST_F_L0(PtScriptTest, PtScriptLocationsTest)
     auto resultLocations = script.GetLocations();
     ASSERT_EQ(resultLocations.size(), 2);
 }
+
+HWTEST_F_L0(PtScriptTest, PtScriptSourceLoaderTest)
+{
+    // the source is loaded from the file each time it is asked for, and never held by the script
+    uint32_t loadCount = 0;
+    auto sourceLoader = [&loadCount](const std::string &fileName) -> std::string {
+        loadCount++;
+        return "source of " + fileName;
+    };
+    PtScript script(0, "lazy.abc", "lazy.js", 10, sourceLoader);
+    ASSERT_TRUE(script.HasSourceLoader());
+    ASSERT_EQ(script.GetEndLine(), 10);
+    ASSERT_EQ(loadCount, 0U);
+    ASSERT_EQ(script.GetScriptSource(), "source of lazy.abc");
+    ASSERT_EQ(script.GetScriptSource(), "source of lazy.abc");
+    ASSERT_EQ(loadCount, 2U);
+
+    // a source set on the script replaces the loader
+    script.SetScriptSource("a=1");
+    ASSERT_FALSE(script.HasSourceLoader());
+    ASSERT_EQ(script.GetScriptSource(), "a=1");
+    ASSERT_EQ(loadCount, 2U);
+}
+
+HWTEST_F_L0(PtScriptTest, PtScriptSourceCacheTest)
+{
+    PtScriptSourceCache cache;
+    // nothing is cached without a capacity
+    cache.Insert(0, "aaaa");
+    ASSERT_EQ(cache.Find(0), nullptr);
+    ASSERT_EQ(cache.GetSize(), 0U);
+
+    cache.SetCapacity(10); // 10: bytes of sources
+    cache.Insert(0, "aaaa");
+    cache.Insert(1, "bbbb");
+    ASSERT_EQ(cache.GetSize(), 8U);
+    // finding a source makes it the most recently used, so the other one is evicted first
+    ASSERT_NE(cache.Find(0), nullptr);
+    cache.Insert(2, "cccc");
+    ASSERT_EQ(cache.GetSize(), 8U);
+    ASSERT_EQ(cache.Find(1), nullptr);
+    ASSERT_EQ(*cache.Find(0), "aaaa");
+    ASSERT_EQ(*cache.Find(2), "cccc");
+
+    // a source larger than the capacity is not cached, and does not evict the others
+    cache.Insert(3, "ddddddddddd");
+    ASSERT_EQ(cache.Find(3), nullptr);
+    ASSERT_EQ(cache.GetSize(), 8U);
+
+    // a smaller capacity evicts the least recently used sources
+    cache.SetCapacity(4); // 4: bytes of sources
+    ASSERT_EQ(cache.GetSize(), 4U);
+    ASSERT_EQ(cache.Find(0), nullptr);
+    ASSERT_EQ(*cache.Find(2), "cccc");
+}
 }  // namespace panda::test
\ No newline at end of file
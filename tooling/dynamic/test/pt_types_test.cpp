@@ -1200,4 +1200,81 @@ HWTEST_F_L0(PtTypesTest, InvalidUtf16DescriptionTest)
     std::string symbolDesc = symbolObj.GetDescription();
     ASSERT_TRUE(symbolDesc.find(invalidStrInDebugger) != std::string::npos);
 }
+
+HWTEST_F_L0(PtTypesTest, AbbreviateDescriptionTest)
+{
+    ASSERT_EQ(RemoteObject::AbbreviateDescription("abc", 3), "abc");  // 3: length of the description
+    ASSERT_EQ(RemoteObject::AbbreviateDescription("abcdef", 3), "abc...");  // 3: length kept
+    // the 3 bytes of each character are never split
+    std::string text = "\xE4\xB8\xAD\xE6\x96\x87";
+    ASSERT_EQ(RemoteObject::AbbreviateDescription(text, 4), "\xE4\xB8\xAD...");  // 4: inside the second character
+    ASSERT_EQ(RemoteObject::AbbreviateDescription(text, 2), "...");  // 2: inside the first character
+}
+
+HWTEST_F_L0(PtTypesTest, GiantStringRemoteObjectTest)
+{
+    // 1000000: bytes of the string, far over the length of a description
+    std::string giant(1000000, 'a');
+    Local<StringRef> giantRef = StringRef::NewFromUtf8(ecmaVm, giant.c_str(), giant.size());
+    StringRemoteObject strObj(ecmaVm, giantRef);
+    std::string expected = giant.substr(0, RemoteObject::MAX_DESCRIPTION_LENGTH) + "...";
+    ASSERT_EQ(strObj.GetDescription(), expected);
+    // the value is kept whole
+    ASSERT_EQ(strObj.GetUnserializableValue(), giant);
+    ASSERT_FALSE(strObj.HasPreviewValue());
+    // the value and the description are all of the message
+    ASSERT_TRUE(strObj.ToJson()->Stringify().size() < giant.size() + 2 * RemoteObject::MAX_DESCRIPTION_LENGTH);
+
+    // a short string is kept whole
+    StringRemoteObject shortObj(ecmaVm, StringRef::NewFromUtf8(ecmaVm, "short"));
+    ASSERT_EQ(shortObj.GetDescription(), "short");
+
+    // the source of a regexp is cut off as well
+    ObjectFactory *factory = ecmaVm->GetFactory();
+    JSHandle<JSHClass> jsRegExpClass = factory->NewEcmaHClass(JSRegExp::SIZE, JSType::JS_REG_EXP);
+    JSHandle<JSRegExp> jsRegExp = JSHandle<JSRegExp>::Cast(factory->NewJSObject(jsRegExpClass));
+    jsRegExp->SetOriginalSource(thread, JSNApiHelper::ToJSTaggedValue(*giantRef));
+    Local<RegExpRef> regExpRef = JSNApiHelper::ToLocal<RegExpRef>(JSHandle<JSTaggedValue>::Cast(jsRegExp));
+    ObjectRemoteObject regExpObj(ecmaVm, regExpRef, RemoteObject::ClassName::Regexp,
+        RemoteObject::SubTypeName::Regexp);
+    // 3: length of "...", which may be followed by the hash of the object
+    ASSERT_EQ(regExpObj.GetDescription().compare(RemoteObject::MAX_DESCRIPTION_LENGTH, 3, "..."), 0);
+    ASSERT_FALSE(regExpObj.HasPreviewValue());
+}
+
+HWTEST_F_L0(PtTypesTest, NestedContainerDescriptionTest)
+{
+    // 1000: bytes of each string, over the length of an entry
+    std::string longKey(1000, 'k');
+    std::string longValue(1000, 'v');
+    std::string key = longKey.substr(0, RemoteObject::MAX_ENTRY_DESCRIPTION_LENGTH) + "...";
+    std::string value = longValue.substr(0, RemoteObject::MAX_ENTRY_DESCRIPTION_LENGTH) + "...";
+
+    Local<SetRef> innerSet = SetRef::New(ecmaVm);
+    innerSet->Add(ecmaVm, StringRef::NewFromUtf8(ecmaVm, longValue.c_str()));
+    Local<MapRef> innerMap = MapRef::New(ecmaVm);
+    innerMap->Set(ecmaVm, StringRef::NewFromUtf8(ecmaVm, "set"), innerSet);
+    Local<MapRef> map = MapRef::New(ecmaVm);
+    map->Set(ecmaVm, StringRef::NewFromUtf8(ecmaVm, longKey.c_str()),
+        StringRef::NewFromUtf8(ecmaVm, longValue.c_str()));
+    map->Set(ecmaVm, StringRef::NewFromUtf8(ecmaVm, "inner"), innerMap);
+    std::string arrayOrContainer;
+    std::string description = ObjectRemoteObject::DescriptionForObject(ecmaVm, map, arrayOrContainer);
+    // the nested containers are not described inside their parent
+    ASSERT_EQ(description, "Map(2) {'" + key + "' => '" + value + "', 'inner' => Object}");
+
+    // however many and long the entries are, a few of them are listed
+    Local<SetRef> set = SetRef::New(ecmaVm);
+    // 1000: entries of the set
+    for (int32_t i = 0; i < 1000; i++) {
+        set->Add(ecmaVm, StringRef::NewFromUtf8(ecmaVm, (longValue + std::to_string(i)).c_str()));
+    }
+    std::string setDesc = ObjectRemoteObject::DescriptionForObject(ecmaVm, set, arrayOrContainer);
+    // 5: entries listed, 2: quotes of each, 8: separators between them
+    size_t maxLength = std::string("Set(1000) {}").size() + 5 * (value.size() + 2) + 8 + std::string(", ...").size();
+    ASSERT_TRUE(setDesc.size() <= maxLength);
+    ASSERT_TRUE(setDesc.find("'" + value + "'") != std::string::npos);
+    ObjectRemoteObject setObj(ecmaVm, set, RemoteObject::ClassName::Set, RemoteObject::SubTypeName::Set);
+    ASSERT_FALSE(setObj.HasPreviewValue());
+}
 }  // namespace panda::test
@@ -254,4 +254,51 @@ HWTEST_F_L0(RuntimeImplTest, DispatcherImplDispatchGetHeapUsage)
     }
 }
 
+HWTEST_F_L0(RuntimeImplTest, DispatcherImplDispatchReleaseObject)
+{
+    std::string result = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&result]([[maybe_unused]] const void *ptr, const std::string &temp) {result = temp;};
+    ProtocolChannel *channel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, channel);
+    auto dispatcherImpl = std::make_unique<RuntimeImpl::DispatcherImpl>(channel, std::move(runtimeImpl));
+    std::string msg = std::string() + R"({"id":0,"method":"Runtime.releaseObject","params":{"objectId":0}})";
+    DispatchRequest request(msg);
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(result.c_str(), R"({"id":0,"result":{"code":1,"message":"wrong params"}})");
+
+    // releasing an unknown object is not an error
+    msg = std::string() + R"({"id":0,"method":"Runtime.releaseObject","params":{"objectId":"0"}})";
+    DispatchRequest request1(msg);
+    dispatcherImpl->Dispatch(request1);
+    EXPECT_STREQ(result.c_str(), R"({"id":0,"result":{}})");
+    if (channel != nullptr) {
+        delete channel;
+        channel = nullptr;
+    }
+}
+
+HWTEST_F_L0(RuntimeImplTest, DispatcherImplDispatchReleaseObjectGroup)
+{
+    std::string result = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&result]([[maybe_unused]] const void *ptr, const std::string &temp) {result = temp;};
+    ProtocolChannel *channel = new ProtocolHandler(callback, ecmaVm);
+    auto runtimeImpl = std::make_unique<RuntimeImpl>(ecmaVm, channel);
+    auto dispatcherImpl = std::make_unique<RuntimeImpl::DispatcherImpl>(channel, std::move(runtimeImpl));
+    std::string msg = std::string() + R"({"id":0,"method":"Runtime.releaseObjectGroup","params":{}})";
+    DispatchRequest request(msg);
+    dispatcherImpl->Dispatch(request);
+    EXPECT_STREQ(result.c_str(), R"({"id":0,"result":{"code":1,"message":"wrong params"}})");
+
+    msg = std::string() + R"({"id":0,"method":"Runtime.releaseObjectGroup","params":{"objectGroup":"console"}})";
+    DispatchRequest request1(msg);
+    dispatcherImpl->Dispatch(request1);
+    EXPECT_STREQ(result.c_str(), R"({"id":0,"result":{}})");
+    if (channel != nullptr) {
+        delete channel;
+        channel = nullptr;
+    }
+}
+
 }  // namespace panda::test
@@ -0,0 +1,2024 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// a method with a line table of 2000 entries
+function largeMethod() {
+    var sum = 0;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    sum += 0;
+    sum += 1;
+    sum += 2;
+    sum += 3;
+    sum += 4;
+    sum += 5;
+    sum += 6;
+    sum += 7;
+    sum += 8;
+    sum += 9;
+    return sum;
+}
+
+print("large_method test begin");
+largeMethod();
+print("large_method test end");
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+print("large object test begin");
+function inspect() {
+    let cache = {};
+    for (let i = 0; i < 500000; i++) {
+        cache["key" + i] = i;
+    }
+    let list = new Array(500000).fill(0);
+    list.tag = "large";
+    let table = new Map([["a", 1], ["b", 2]]);
+    print("large object test end");
+}
+inspect();
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var captured = 'lazy_scope';
+
+function recursion(n) {
+    var local = n * 2;
+    var closure = function () {
+        return local + captured;
+    };
+    if (n == 0) {
+        return closure();
+    }
+    return recursion(n - 1);
+}
+
+print("lazy_scope test begin");
+recursion(200);
+print("lazy_scope test end");
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function hotLoop(count) {
+    let sum = 0;
+    for (let i = 0; i < count; i++) {
+        sum += i;
+    }
+    return sum;
+}
+
+function recursion(n) {
+    if (n == 0) {
+        let sum = hotLoop(100000);
+        return sum;
+    }
+    return recursion(n - 1);
+}
+
+print("step_hot_loop test begin");
+recursion(1000);
+print("step_hot_loop test end");
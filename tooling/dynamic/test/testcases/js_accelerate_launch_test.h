@@ -40,8 +40,36 @@ public:
             {SocketAction::RECV, "Unknown url", ActionRule::STRING_CONTAIN},
             {SocketAction::SEND, "run"},
             {SocketAction::RECV, "", ActionRule::CUSTOM_RULE, MatchRule::replySuccess},
-            // load sample.js
-            {SocketAction::RECV, "Debugger.scriptParsed", ActionRule::STRING_CONTAIN},
+            // load sample.js, the pending breakpoint is resolved in sample.abc when the script is parsed
+            {SocketAction::RECV, "Debugger.scriptParsed", ActionRule::CUSTOM_RULE,
+                [this] (auto recv, auto, auto) -> bool {
+                    std::unique_ptr<PtJson> json = PtJson::Parse(recv);
+                    std::unique_ptr<PtJson> params = nullptr;
+                    Result ret = json->GetObject("params", &params);
+                    if (ret != Result::SUCCESS) {
+                        return false;
+                    }
+
+                    std::unique_ptr<PtJson> locations = nullptr;
+                    ret = params->GetArray("locations", &locations);
+                    if (ret != Result::SUCCESS || locations->GetSize() != 1) {
+                        return false;
+                    }
+
+                    std::string id;
+                    int32_t lineNumber = -1;
+                    int32_t locationScriptId = -1;
+                    std::string scriptId;
+                    if (locations->Get(0)->GetString("id", &id) != Result::SUCCESS ||
+                        locations->Get(0)->GetInt("lineNumber", &lineNumber) != Result::SUCCESS ||
+                        locations->Get(0)->GetInt("scriptId", &locationScriptId) != Result::SUCCESS ||
+                        params->GetString("scriptId", &scriptId) != Result::SUCCESS) {
+                        return false;
+                    }
+                    // 21: zero-based line of the breakpoint set on line 22
+                    return id != "invalid" && id.find(sourceFile_) != std::string::npos && lineNumber == 21 &&
+                        std::to_string(locationScriptId) == scriptId;
+                }},
             {SocketAction::RECV, "Debugger.paused", ActionRule::STRING_CONTAIN},
             {SocketAction::SEND, "resume"},
             {SocketAction::RECV, "Debugger.resumed", ActionRule::STRING_CONTAIN},
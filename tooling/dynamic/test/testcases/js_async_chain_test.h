@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_ASYNC_CHAIN_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_ASYNC_CHAIN_TEST_H
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsAsyncChainTest : public TestEvents {
+public:
+    JsAsyncChainTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+
+            // the whole chain up to the depth, as Debugger.paused carries it without the ids
+            Paused legacyPaused;
+            legacyPaused.SetAsyncCallChainDepth(maxDepth_).SetAysncStack(DebuggerApi::GetCurrentAsyncParent(vm_));
+            size_t legacySize = legacyPaused.ToJson()->Stringify().size();
+
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+            auto channel = static_cast<JsAsyncChainTestChannel *>(channel_);
+            ASSERT_TRUE(channel->GetPausedSize() > 0);
+            ASSERT_TRUE(channel->GetPausedSize() < legacySize);
+            std::cout << "JsAsyncChainTest: paused of " << channel->GetPausedSize() << " bytes, "
+                      << legacySize << " bytes with the chain inlined" << std::endl;
+
+            // paused in a continuation, the async stack trace has a parent
+            ASSERT_FALSE(channel->GetParentId().empty());
+            // the parents are fetched by id, and the chain ends at the depth of setAsyncCallStackDepth
+            std::vector<std::string> ids = WalkParents(channel->GetParentId());
+            ASSERT_EQ(ids.size() + 1, static_cast<size_t>(maxDepth_));
+            // a segment keeps its id as long as its async stack is alive
+            ASSERT_TRUE(WalkParents(channel->GetParentId()) == ids);
+
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "async_chain.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "async_chain.js";
+            runtime_->Enable();
+            UniqueDebuggerId id;
+            auto enableParams = EnableParams::Create(*PtJson::Parse("{\"options\":[\"enableAsyncStackTraceId\"]}"));
+            ASSERT_NE(enableParams, nullptr);
+            ASSERT_TRUE(debugger_->Enable(*enableParams, &id).IsOk());
+            auto depthParams = SetAsyncCallStackDepthParams::Create(
+                *PtJson::Parse("{\"maxDepth\":" + std::to_string(maxDepth_) + "}"));
+            ASSERT_NE(depthParams, nullptr);
+            ASSERT_TRUE(debugger_->SetAsyncCallStackDepth(*depthParams).IsOk());
+            // 19: breakpointer line, the end of the chain, only reached in an awaited continuation
+            int32_t lineNumber = 19;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            return true;
+        };
+
+        channel_ = new JsAsyncChainTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "async_chain.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsAsyncChainTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsAsyncChainTestChannel : public TestChannel {
+    public:
+        JsAsyncChainTestChannel() = default;
+        ~JsAsyncChainTestChannel() = default;
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            if (events.GetName() != "Debugger.paused") {
+                return;
+            }
+            auto paused = static_cast<const Paused *>(&events);
+            pausedSize_ = paused->ToJson()->Stringify().size();
+            parentId_.clear();
+            auto asyncStackTrace = paused->GetAsyncStackTrace();
+            ASSERT_NE(asyncStackTrace, nullptr);
+            ASSERT_TRUE(asyncStackTrace->HasParentId());
+            parentId_ = asyncStackTrace->GetParentId()->GetId();
+        }
+
+        size_t GetPausedSize() const
+        {
+            return pausedSize_;
+        }
+
+        const std::string &GetParentId() const
+        {
+            return parentId_;
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsAsyncChainTestChannel);
+        NO_MOVE_SEMANTIC(JsAsyncChainTestChannel);
+
+        size_t pausedSize_ {0};
+        std::string parentId_ {};
+    };
+
+    std::vector<std::string> WalkParents(std::string id)
+    {
+        std::vector<std::string> ids;
+        while (!id.empty()) {
+            ids.emplace_back(id);
+            auto params = GetStackTraceParams::Create(*PtJson::Parse("{\"stackTraceId\":{\"id\":\"" + id + "\"}}"));
+            std::unique_ptr<StackTrace> stackTrace;
+            if (params == nullptr || !debugger_->GetStackTrace(*params, &stackTrace).IsOk()) {
+                break;
+            }
+            id = stackTrace->HasParentId() ? stackTrace->GetParentId()->GetId() : "";
+        }
+        return ids;
+    }
+
+    // 32: depth of the async stack, less than the 200 promises chained in async_chain.js
+    int32_t maxDepth_ {32};
+    std::string entryPoint_ = "async_chain";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsAsyncChainTest()
+{
+    return std::make_unique<JsAsyncChainTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_ASYNC_CHAIN_TEST_H
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_BLACKBOX_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_BLACKBOX_TEST_H
+
+#include <chrono>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsBlackboxTest : public TestEvents {
+public:
+    JsBlackboxTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            debugger_->SetDebuggerState(DebuggerState::PAUSED);
+            debugger_->StepInto(StepIntoParams());
+            stepStart_ = std::chrono::steady_clock::now();
+            return true;
+        };
+
+        // the step into the blackboxed library runs through it and stops back in the caller
+        singleStep = [this](const JSPtLocation &location) {
+            ++singleStepCounter_;
+            if (!debugger_->NotifySingleStep(location)) {
+                return false;
+            }
+            auto stepDuration = std::chrono::steady_clock::now() - stepStart_;
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, stepLocation_);
+            ++stepCompleteCounter_;
+            std::cout << "JsBlackboxTest: step into a blackboxed loop of " << singleStepCounter_ << " bytecodes in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(stepDuration).count()
+                      << "us" << std::endl;
+            TestUtil::SuspendUntilContinue(DebugEvent::STEP_COMPLETE, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            runtime_->Enable();
+            // 24: breakpointer line, the call of the library
+            location_ = TestUtil::GetLocation(sourceFile_.c_str(), 24, 0, pandaFile_.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            // 25: the line after the library returns
+            stepLocation_ = TestUtil::GetLocation(sourceFile_.c_str(), 25, 0, pandaFile_.c_str());
+            ASSERT_TRUE(stepLocation_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile_);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile_));
+
+            // 15, 22: the lines of the library function
+            std::string scriptId = std::to_string(static_cast<JsBlackboxTestChannel *>(channel_)->GetScriptId());
+            auto rangesParams = SetBlackboxedRangesParams::Create(*PtJson::Parse("{\"scriptId\":\"" + scriptId +
+                "\",\"positions\":[{\"lineNumber\":15,\"columnNumber\":0},{\"lineNumber\":22,\"columnNumber\":0}]}"));
+            ASSERT_NE(rangesParams, nullptr);
+            ASSERT_TRUE(debugger_->SetBlackboxedRanges(*rangesParams).IsOk());
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            TestUtil::WaitForStepComplete(stepLocation_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            ASSERT_EQ(stepCompleteCounter_, 1U);  // 1: step complete counter
+            return true;
+        };
+
+        channel_ = new JsBlackboxTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        return {pandaFile_, entryPoint_};
+    }
+    ~JsBlackboxTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsBlackboxTestChannel : public TestChannel {
+    public:
+        JsBlackboxTestChannel() = default;
+        ~JsBlackboxTestChannel() = default;
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            if (events.GetName() == "Debugger.scriptParsed") {
+                scriptId_ = static_cast<const ScriptParsed *>(&events)->GetScriptId();
+            }
+        }
+
+        ScriptId GetScriptId() const
+        {
+            return scriptId_;
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsBlackboxTestChannel);
+        NO_MOVE_SEMANTIC(JsBlackboxTestChannel);
+
+        ScriptId scriptId_ {0};
+    };
+
+    std::string pandaFile_ = DEBUGGER_ABC_DIR "blackbox.abc";
+    std::string sourceFile_ = DEBUGGER_JS_DIR "blackbox.js";
+    std::string entryPoint_ = "blackbox";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    JSPtLocation stepLocation_ {nullptr, JSPtLocation::EntityId(0), 0};
+    std::chrono::steady_clock::time_point stepStart_ {};
+    size_t breakpointCounter_ = 0;
+    size_t singleStepCounter_ = 0;
+    size_t stepCompleteCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsBlackboxTest()
+{
+    return std::make_unique<JsBlackboxTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_BLACKBOX_TEST_H
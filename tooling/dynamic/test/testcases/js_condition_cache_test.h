@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_CONDITION_CACHE_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_CONDITION_CACHE_TEST_H
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include "test/utils/test_util.h"
+#include "tooling/dynamic/base/pt_base64.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsConditionCacheTest : public TestEvents {
+public:
+    JsConditionCacheTest()
+    {
+        // the condition never holds, so the breakpoint never pauses
+        breakpoint = [this](const JSPtLocation &location) {
+            ++breakpointCounter_;
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "condition_cache.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "condition_cache.js";
+            runtime_->Enable();
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+
+            std::ifstream conditionFile(DEBUGGER_ABC_DIR "condition_expr.abc", std::ios::binary);
+            ASSERT_TRUE(conditionFile.is_open());
+            std::stringstream buffer;
+            buffer << conditionFile.rdbuf();
+            std::string bytecode = buffer.str();
+            std::string condition(PtBase64::EncodedSize(bytecode.size()), '\0');
+            condition.resize(PtBase64::Encode(condition.data(), bytecode.data(), bytecode.size()));
+
+            // 18: breakpointer line, the body of the loop
+            std::string breakpointParams = "{\"lineNumber\":18,\"url\":\"" + sourceFile +
+                "\",\"condition\":\"" + condition + "\"}";
+            std::string removeParams = "{\"url\":\"" + sourceFile + "\"}";
+            // the frontend sets the same condition again on every edit and reload
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < resetCount_; i++) {
+                auto setParams = SetBreakpointByUrlParams::Create(*PtJson::Parse(breakpointParams));
+                ASSERT_NE(setParams, nullptr);
+                std::string id;
+                std::vector<std::unique_ptr<Location>> locations;
+                ASSERT_TRUE(debugger_->SetBreakpointByUrl(*setParams, &id, &locations).IsOk());
+                ASSERT_EQ(locations.size(), 1U);
+                if (i + 1 < resetCount_) {
+                    auto params = RemoveBreakpointsByUrlParams::Create(*PtJson::Parse(removeParams));
+                    ASSERT_NE(params, nullptr);
+                    ASSERT_TRUE(debugger_->RemoveBreakpointsByUrl(*params).IsOk());
+                }
+            }
+            auto resetDuration = std::chrono::steady_clock::now() - start;
+            std::cout << "JsConditionCacheTest: " << resetCount_ << " conditional breakpoints set in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(resetDuration).count()
+                      << "us" << std::endl;
+            runStart_ = std::chrono::steady_clock::now();
+            return true;
+        };
+
+        scenario = []() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            auto runDuration = std::chrono::steady_clock::now() - runStart_;
+            ASSERT_EQ(breakpointCounter_, 0U);  // 0: break point counter
+            Local<JSValueRef> hits =
+                JSNApi::GetGlobalObject(vm_)->Get(vm_, StringRef::NewFromUtf8(vm_, "conditionHits"));
+            ASSERT_TRUE(hits->IsNumber());
+            ASSERT_EQ(static_cast<uint32_t>(hits->ToNumber(vm_)->Value()), loopCount_);
+            std::cout << "JsConditionCacheTest: " << loopCount_ << " conditions evaluated in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(runDuration).count()
+                      << "us" << std::endl;
+            return true;
+        };
+
+        channel_ = new TestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "condition_cache.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsConditionCacheTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    // 1000: times the conditional breakpoint is set
+    uint32_t resetCount_ {1000};
+    // 100000: iterations of the loop in condition_cache.js
+    uint32_t loopCount_ {100000};
+    std::string entryPoint_ = "condition_cache";
+    std::chrono::steady_clock::time_point runStart_ {};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsConditionCacheTest()
+{
+    return std::make_unique<JsConditionCacheTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_CONDITION_CACHE_TEST_H
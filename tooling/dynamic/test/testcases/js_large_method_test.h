@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LARGE_METHOD_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LARGE_METHOD_TEST_H
+
+#include <chrono>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsLargeMethodTest : public TestEvents {
+public:
+    JsLargeMethodTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+
+            // every step into the method looks up the step ranges in its line table
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < iterations_; i++) {
+                auto stepper = SingleStepper::GetStepOverStepper(vm_);
+                ASSERT_NE(stepper, nullptr);
+            }
+            auto stepDuration = std::chrono::steady_clock::now() - start;
+
+            // every pause in the method builds its local scope from the line table
+            start = std::chrono::steady_clock::now();
+            auto params = GetCallFramesParams::Create(*PtJson::Parse("{\"start\":0,\"count\":1}"));
+            ASSERT_NE(params, nullptr);
+            for (uint32_t i = 0; i < iterations_; i++) {
+                std::vector<std::unique_ptr<CallFrame>> callFrames;
+                bool hasMore = false;
+                ASSERT_TRUE(debugger_->GetCallFrames(*params, &callFrames, &hasMore).IsOk());
+                ASSERT_EQ(callFrames.size(), 1U);
+                ASSERT_EQ(callFrames[0]->GetFunctionName(), "largeMethod");
+            }
+            auto pauseDuration = std::chrono::steady_clock::now() - start;
+            std::cout << "JsLargeMethodTest: " << iterations_ << " step overs in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(stepDuration).count()
+                      << "us, " << iterations_ << " top frames in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(pauseDuration).count()
+                      << "us" << std::endl;
+
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "large_method.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "large_method.js";
+            runtime_->Enable();
+            // 1017: breakpointer line, in the middle of the line table
+            int32_t lineNumber = 1017;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            return true;
+        };
+
+        channel_ = new TestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "large_method.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsLargeMethodTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    // 1000: lookups per benchmark
+    uint32_t iterations_ {1000};
+    std::string entryPoint_ = "large_method";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsLargeMethodTest()
+{
+    return std::make_unique<JsLargeMethodTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LARGE_METHOD_TEST_H
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LARGE_OBJECT_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LARGE_OBJECT_TEST_H
+
+#include <chrono>
+#include <map>
+#include <unordered_set>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsLargeObjectTest : public TestEvents {
+public:
+    JsLargeObjectTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "large_object.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "large_object.js";
+            static_cast<JsLargeObjectTestChannel *>(channel_)->Initial(runtime_);
+            runtime_->Enable();
+            // 25: breakpointer line, after the object, the array and the map are filled
+            int32_t lineNumber = 25;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            return true;
+        };
+
+        channel_ = new JsLargeObjectTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "large_object.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsLargeObjectTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsLargeObjectTestChannel : public TestChannel {
+    public:
+        JsLargeObjectTestChannel() = default;
+        ~JsLargeObjectTestChannel() = default;
+        void Initial(RuntimeImpl *runtime)
+        {
+            runtime_ = runtime;
+        }
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            if (events.GetName() != "Debugger.paused") {
+                return;
+            }
+            auto paused = static_cast<const Paused *>(&events);
+            auto frame = paused->GetCallFrames()->at(0).get();
+            ASSERT_EQ(frame->GetFunctionName(), "inspect");
+            std::map<std::string, RemoteObjectId> objectIds;
+            for (const auto &scope : *frame->GetScopeChain()) {
+                if (scope->GetType() != Scope::Type::Local()) {
+                    continue;
+                }
+                std::vector<std::unique_ptr<PropertyDescriptor>> outPropertyDesc;
+                GetPropertiesParams params;
+                params.SetObjectId(scope->GetObject()->GetObjectId()).SetOwnProperties(true);
+                runtime_->GetProperties(params, &outPropertyDesc, {}, {}, {});
+                for (const auto &property : outPropertyDesc) {
+                    if (property->HasValue() && property->GetValue()->HasObjectId()) {
+                        objectIds[property->GetName()] = property->GetValue()->GetObjectId();
+                    }
+                }
+            }
+            ASSERT_EQ(objectIds.count("cache"), 1U);
+            ASSERT_EQ(objectIds.count("list"), 1U);
+            ASSERT_EQ(objectIds.count("table"), 1U);
+
+            // the pages of the object cover each of its keys once, and the last one says it is the last
+            auto start = std::chrono::steady_clock::now();
+            int32_t pageStart = 0;
+            std::unordered_set<std::string> keys;
+            bool hasMore = true;
+            std::chrono::steady_clock::duration firstPageDuration {};
+            while (hasMore) {
+                std::vector<std::unique_ptr<PropertyDescriptor>> page;
+                ASSERT_TRUE(GetPage(objectIds["cache"], pageStart, &page, &hasMore));
+                if (pageStart == 0) {
+                    firstPageDuration = std::chrono::steady_clock::now() - start;
+                }
+                for (const auto &property : page) {
+                    if (property->GetName().rfind("key", 0) == 0) {
+                        ASSERT_TRUE(keys.insert(property->GetName()).second);
+                    }
+                }
+                pageStart += pageSize_;
+            }
+            auto walkDuration = std::chrono::steady_clock::now() - start;
+            ASSERT_EQ(keys.size(), propertyCount_);
+            std::cout << "JsLargeObjectTest: first page of " << pageSize_ << " keys in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(firstPageDuration).count()
+                      << "us, " << keys.size() << " keys in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(walkDuration).count()
+                      << "us" << std::endl;
+
+            // the page after the last one is empty
+            std::vector<std::unique_ptr<PropertyDescriptor>> page;
+            ASSERT_TRUE(GetPage(objectIds["cache"], static_cast<int32_t>(propertyCount_) + 1, &page, &hasMore));
+            ASSERT_TRUE(page.empty());
+            ASSERT_FALSE(hasMore);
+
+            // the elements of an array are read by index, and its named properties follow the last of them
+            int32_t lastPage = static_cast<int32_t>(propertyCount_) - pageSize_;
+            page.clear();
+            ASSERT_TRUE(GetPage(objectIds["list"], lastPage, &page, &hasMore));
+            ASSERT_EQ(page.size(), static_cast<size_t>(pageSize_));
+            ASSERT_EQ(page.front()->GetName(), std::to_string(lastPage));
+            ASSERT_TRUE(hasMore);
+            page.clear();
+            ASSERT_TRUE(GetPage(objectIds["list"], lastPage + pageSize_, &page, &hasMore));
+            ASSERT_EQ(page.size(), 2U);  // 2: 'length' and 'tag'
+            ASSERT_EQ(page.front()->GetName(), "length");
+            ASSERT_EQ(page.back()->GetName(), "tag");
+            ASSERT_FALSE(hasMore);
+
+            // a page past the end of a map lists all of its entries, as it did before the objects were paged
+            page.clear();
+            ASSERT_TRUE(GetPage(objectIds["table"], pageSize_, &page, &hasMore));
+            ASSERT_FALSE(hasMore);
+            RemoteObjectId entriesId = -1;
+            for (const auto &property : page) {
+                if (property->GetName() == "[[Map]]" && property->HasValue()) {
+                    entriesId = property->GetValue()->GetObjectId();
+                }
+            }
+            ASSERT_NE(entriesId, -1);
+            std::vector<std::unique_ptr<PropertyDescriptor>> entries;
+            GetPropertiesParams entriesParams;
+            entriesParams.SetObjectId(entriesId).SetOwnProperties(true);
+            runtime_->GetProperties(entriesParams, &entries, {}, {}, {});
+            std::unordered_set<std::string> entryNames;
+            for (const auto &entry : entries) {
+                entryNames.insert(entry->GetName());
+            }
+            ASSERT_EQ(entryNames.count("0"), 1U);
+            ASSERT_EQ(entryNames.count("1"), 1U);
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsLargeObjectTestChannel);
+        NO_MOVE_SEMANTIC(JsLargeObjectTestChannel);
+
+        bool GetPage(RemoteObjectId objectId, int32_t pageStart,
+            std::vector<std::unique_ptr<PropertyDescriptor>> *page, bool *hasMore)
+        {
+            auto params = GetPropertiesParams::Create(*PtJson::Parse("{\"objectId\":\"" + std::to_string(objectId) +
+                "\",\"ownProperties\":true,\"start\":" + std::to_string(pageStart) +
+                ",\"count\":" + std::to_string(pageSize_) + "}"));
+            if (params == nullptr) {
+                return false;
+            }
+            std::optional<bool> outHasMore;
+            if (!runtime_->GetProperties(*params, page, {}, {}, {}, &outHasMore).IsOk() || !outHasMore) {
+                return false;
+            }
+            *hasMore = outHasMore.value();
+            return true;
+        }
+
+        // 500000: keys of the object and elements of the array in large_object.js
+        size_t propertyCount_ {500000};
+        // 1000: properties per page
+        int32_t pageSize_ {1000};
+        RuntimeImpl *runtime_ {nullptr};
+    };
+
+    std::string entryPoint_ = "large_object";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsLargeObjectTest()
+{
+    return std::make_unique<JsLargeObjectTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LARGE_OBJECT_TEST_H
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LAZY_SCOPE_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LAZY_SCOPE_TEST_H
+
+#include <chrono>
+#include <map>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsLazyScopeTest : public TestEvents {
+public:
+    JsLazyScopeTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            static_cast<JsLazyScopeTestChannel *>(channel_)->SetPauseStart(std::chrono::steady_clock::now());
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "lazy_scope.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "lazy_scope.js";
+            static_cast<JsLazyScopeTestChannel *>(channel_)->Initial(vm_, runtime_);
+            runtime_->Enable();
+            // 23: breakpointer line, the deepest frame of the recursion
+            int32_t lineNumber = 23;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            return true;
+        };
+
+        channel_ = new JsLazyScopeTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "lazy_scope.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsLazyScopeTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsLazyScopeTestChannel : public TestChannel {
+    public:
+        JsLazyScopeTestChannel() = default;
+        ~JsLazyScopeTestChannel() = default;
+        void Initial(const EcmaVM *vm, RuntimeImpl *runtime)
+        {
+            vm_ = vm;
+            runtime_ = runtime;
+        }
+
+        void SetPauseStart(std::chrono::steady_clock::time_point pauseStart)
+        {
+            pauseStart_ = pauseStart;
+        }
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            const static std::vector<std::function<bool(const PtBaseEvents &events)>> eventList = {
+                [](const PtBaseEvents &events) -> bool {
+                    std::string sourceFile = DEBUGGER_JS_DIR "lazy_scope.js";
+                    auto parsed = static_cast<const ScriptParsed *>(&events);
+                    ASSERT_EQ(parsed->GetName(), "Debugger.scriptParsed");
+                    ASSERT_EQ(parsed->GetUrl(), sourceFile);
+                    return true;
+                },
+                [this](const PtBaseEvents &events) -> bool {
+                    auto pauseDuration = std::chrono::steady_clock::now() - pauseStart_;
+                    auto paused = static_cast<const Paused *>(&events);
+                    ASSERT_EQ(paused->GetName(), "Debugger.paused");
+                    auto callFrames = paused->GetCallFrames();
+                    ASSERT_TRUE(callFrames->size() > recursionDepth_);
+
+                    // expanding the scopes of every frame costs what an eager pause did
+                    auto start = std::chrono::steady_clock::now();
+                    size_t scopeCount = 0;
+                    for (const auto &callFrame : *callFrames) {
+                        for (const auto &scope : *callFrame->GetScopeChain()) {
+                            if (scope->GetType() != Scope::Type::Local() &&
+                                scope->GetType() != Scope::Type::Closure()) {
+                                continue;
+                            }
+                            std::vector<std::unique_ptr<PropertyDescriptor>> outPropertyDesc;
+                            GetPropertiesParams params;
+                            params.SetObjectId(scope->GetObject()->GetObjectId()).SetOwnProperties(true);
+                            runtime_->GetProperties(params, &outPropertyDesc, {}, {}, {});
+                            scopeCount++;
+                        }
+                    }
+                    auto expandDuration = std::chrono::steady_clock::now() - start;
+                    std::cout << "JsLazyScopeTestChannel: pause with " << callFrames->size() << " frames in "
+                              << std::chrono::duration_cast<std::chrono::microseconds>(pauseDuration).count()
+                              << "us, expand " << scopeCount << " scopes in "
+                              << std::chrono::duration_cast<std::chrono::microseconds>(expandDuration).count()
+                              << "us" << std::endl;
+
+                    // the top frame resolves the same variables as an eager scope chain
+                    auto frame = callFrames->at(0).get();
+                    ASSERT_EQ(frame->GetFunctionName(), "recursion");
+                    std::map<std::string, std::string> variables;
+                    for (const auto &scope : *frame->GetScopeChain()) {
+                        if (scope->GetType() != Scope::Type::Local() &&
+                            scope->GetType() != Scope::Type::Closure()) {
+                            continue;
+                        }
+                        std::vector<std::unique_ptr<PropertyDescriptor>> outPropertyDesc;
+                        GetPropertiesParams params;
+                        params.SetObjectId(scope->GetObject()->GetObjectId()).SetOwnProperties(true);
+                        runtime_->GetProperties(params, &outPropertyDesc, {}, {}, {});
+                        for (const auto &property : outPropertyDesc) {
+                            auto value = property->GetValue();
+                            if (value->HasValue()) {
+                                variables[property->GetName()] = value->GetValue()->ToString(vm_)->ToString(vm_);
+                            }
+                        }
+                    }
+                    // 'n' is a local variable and 'local' is captured by the closure
+                    ASSERT_EQ(variables["n"], "0");
+                    ASSERT_EQ(variables["local"], "0");
+                    return true;
+                }
+            };
+
+            ASSERT_TRUE(eventList[index_](events));
+            index_++;
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsLazyScopeTestChannel);
+        NO_MOVE_SEMANTIC(JsLazyScopeTestChannel);
+
+        // 200: recursion depth in lazy_scope.js
+        size_t recursionDepth_ {200};
+        std::chrono::steady_clock::time_point pauseStart_ {};
+        int32_t index_ {0};
+        const EcmaVM *vm_ {nullptr};
+        RuntimeImpl *runtime_ {nullptr};
+    };
+
+    std::string entryPoint_ = "lazy_scope";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsLazyScopeTest()
+{
+    return std::make_unique<JsLazyScopeTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LAZY_SCOPE_TEST_H
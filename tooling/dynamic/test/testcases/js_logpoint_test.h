@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LOGPOINT_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LOGPOINT_TEST_H
+
+#include <chrono>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsLogpointTest : public TestEvents {
+public:
+    JsLogpointTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            // as JSPtHooks, logpoints and unmet hit conditions do not pause
+            if (!debugger_->NotifyBreakpointHit(location)) {
+                return true;
+            }
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "logpoint.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "logpoint.js";
+            runtime_->Enable();
+            // 20: breakpointer line, 'count++' in the loop
+            int32_t lineNumber = 20;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+
+            // 19: logpoint line, 'sum += i' in the loop, logged on every 1000th hit
+            ASSERT_TRUE(SetBreakpointByUrl("{\"lineNumber\":19,\"url\":\"" + sourceFile +
+                "\",\"logMessage\":\"i = {i}, sum = {sum}, {unknown}\",\"hitCondition\":\"%1000\"}"));
+            // pauses on the last iteration only
+            ASSERT_TRUE(SetBreakpointByUrl("{\"lineNumber\":20,\"url\":\"" + sourceFile +
+                "\",\"hitCondition\":\">99999\"}"));
+            // a malformed hit condition is refused
+            ASSERT_FALSE(SetBreakpointByUrl("{\"lineNumber\":20,\"url\":\"" + sourceFile +
+                "\",\"hitCondition\":\"%0\"}"));
+            runStart_ = std::chrono::steady_clock::now();
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            auto runDuration = std::chrono::steady_clock::now() - runStart_;
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            auto channel = static_cast<JsLogpointTestChannel *>(channel_);
+            // 100: 100000 hits of the logpoint logged every 1000th
+            ASSERT_EQ(channel->GetLogCount(), 100U);
+            // the 1000th hit is in the iteration of i = 999
+            ASSERT_EQ(channel->GetFirstLog(), "i = 999, sum = 498501, {unknown}");
+            std::cout << "JsLogpointTest: " << loopCount_ << " hits of a logpoint and a hit counted breakpoint in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(runDuration).count()
+                      << "us" << std::endl;
+            return true;
+        };
+
+        channel_ = new JsLogpointTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "logpoint.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsLogpointTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsLogpointTestChannel : public TestChannel {
+    public:
+        JsLogpointTestChannel() = default;
+        ~JsLogpointTestChannel() = default;
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            if (events.GetName() != "Runtime.consoleAPICalled") {
+                return;
+            }
+            auto consoleAPICalled = static_cast<const ConsoleAPICalled *>(&events);
+            if (logCount_ == 0) {
+                firstLog_ = consoleAPICalled->GetArgs()->at(0)->GetDescription();
+            }
+            logCount_++;
+        }
+
+        uint32_t GetLogCount() const
+        {
+            return logCount_;
+        }
+
+        const std::string &GetFirstLog() const
+        {
+            return firstLog_;
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsLogpointTestChannel);
+        NO_MOVE_SEMANTIC(JsLogpointTestChannel);
+
+        uint32_t logCount_ {0};
+        std::string firstLog_ {};
+    };
+
+    bool SetBreakpointByUrl(const std::string &breakpointParams)
+    {
+        auto params = SetBreakpointByUrlParams::Create(*PtJson::Parse(breakpointParams));
+        if (params == nullptr) {
+            return false;
+        }
+        std::string id;
+        std::vector<std::unique_ptr<Location>> locations;
+        return debugger_->SetBreakpointByUrl(*params, &id, &locations).IsOk();
+    }
+
+    // 100000: iterations of the loop in logpoint.js
+    uint32_t loopCount_ {100000};
+    std::string entryPoint_ = "logpoint";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    std::chrono::steady_clock::time_point runStart_ {};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsLogpointTest()
+{
+    return std::make_unique<JsLogpointTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_LOGPOINT_TEST_H
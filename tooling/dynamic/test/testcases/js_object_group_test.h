@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_OBJECT_GROUP_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_OBJECT_GROUP_TEST_H
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsObjectGroupTest : public TestEvents {
+public:
+    JsObjectGroupTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            retainedBeforePause_ = runtime_->GetRetainedObjectCount();
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+            InspectPausedFrame();
+            double totalSize = 0;
+            runtime_->GetHeapUsage(&firstUsedSize_, &totalSize);
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            ASSERT_TRUE(debugger_->StepOver(StepOverParams()).IsOk());
+            CheckReleased();
+            return true;
+        };
+
+        // every step pauses, inspects the top frame and resumes again
+        singleStep = [this](const JSPtLocation &location) {
+            if (!debugger_->NotifySingleStep(location)) {
+                return false;
+            }
+            debugger_->NotifyPaused({}, PauseReason::OTHER);
+            InspectPausedFrame();
+            if (++stepCounter_ < stepCount_) {
+                ASSERT_TRUE(debugger_->StepOver(StepOverParams()).IsOk());
+            } else {
+                double usedSize = 0;
+                double totalSize = 0;
+                runtime_->GetHeapUsage(&usedSize, &totalSize);
+                std::cout << "JsObjectGroupTest: heap used " << firstUsedSize_ << " bytes on the first pause, "
+                          << usedSize << " bytes after " << stepCounter_ << " steps, at most "
+                          << maxRetainedCount_ << " objects retained on a pause" << std::endl;
+                ASSERT_TRUE(debugger_->Resume(ResumeParams()).IsOk());
+            }
+            CheckReleased();
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "object_group.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "object_group.js";
+            runtime_->Enable();
+            // 20: breakpointer line, before the loop
+            int32_t lineNumber = 20;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            ASSERT_EQ(stepCounter_, stepCount_);
+            return true;
+        };
+
+        channel_ = new JsObjectGroupTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "object_group.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsObjectGroupTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsObjectGroupTestChannel : public TestChannel {
+    public:
+        JsObjectGroupTestChannel() = default;
+        ~JsObjectGroupTestChannel() = default;
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            if (events.GetName() != "Debugger.paused") {
+                return;
+            }
+            auto paused = static_cast<const Paused *>(&events);
+            auto callFrames = paused->GetCallFrames();
+            ASSERT_TRUE(!callFrames->empty());
+            localScopeId_ = -1;
+            for (const auto &scope : *callFrames->at(0)->GetScopeChain()) {
+                if (scope->GetType() == Scope::Type::Local()) {
+                    localScopeId_ = scope->GetObject()->GetObjectId();
+                }
+            }
+        }
+
+        RemoteObjectId GetLocalScopeId() const
+        {
+            return localScopeId_;
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsObjectGroupTestChannel);
+        NO_MOVE_SEMANTIC(JsObjectGroupTestChannel);
+
+        RemoteObjectId localScopeId_ {-1};
+    };
+
+    // expand the local scope of the top frame as a frontend showing the variables does
+    void InspectPausedFrame()
+    {
+        inspectedIds_.clear();
+        RemoteObjectId localScopeId = static_cast<JsObjectGroupTestChannel *>(channel_)->GetLocalScopeId();
+        ASSERT_NE(localScopeId, -1);
+        inspectedIds_.push_back(localScopeId);
+        std::vector<std::unique_ptr<PropertyDescriptor>> outPropertyDesc;
+        GetPropertiesParams params;
+        params.SetObjectId(localScopeId).SetOwnProperties(true);
+        ASSERT_TRUE(runtime_->GetProperties(params, &outPropertyDesc, {}, {}, {}).IsOk());
+        for (const auto &property : outPropertyDesc) {
+            if (property->HasValue() && property->GetValue()->HasObjectId()) {
+                inspectedIds_.push_back(property->GetValue()->GetObjectId());
+            }
+        }
+        size_t retainedCount = runtime_->GetRetainedObjectCount();
+        ASSERT_TRUE(retainedCount > retainedBeforePause_);
+        maxRetainedCount_ = std::max(maxRetainedCount_, retainedCount);
+    }
+
+    // the objects handed out for the paused frame are in the backtrace group and gone after resuming, checked
+    // before the next pause frees every remaining object, so the count does not grow with the steps
+    void CheckReleased()
+    {
+        ASSERT_EQ(runtime_->GetRetainedObjectCount(), retainedBeforePause_);
+        for (RemoteObjectId objectId : inspectedIds_) {
+            std::vector<std::unique_ptr<PropertyDescriptor>> outPropertyDesc;
+            GetPropertiesParams params;
+            params.SetObjectId(objectId).SetOwnProperties(true);
+            ASSERT_FALSE(runtime_->GetProperties(params, &outPropertyDesc, {}, {}, {}).IsOk());
+        }
+    }
+
+    // 10000: steps over the loop
+    uint32_t stepCount_ {10000};
+    uint32_t stepCounter_ {0};
+    std::vector<RemoteObjectId> inspectedIds_ {};
+    size_t retainedBeforePause_ {0};
+    size_t maxRetainedCount_ {0};
+    double firstUsedSize_ {0};
+    std::string entryPoint_ = "object_group";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsObjectGroupTest()
+{
+    return std::make_unique<JsObjectGroupTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_OBJECT_GROUP_TEST_H
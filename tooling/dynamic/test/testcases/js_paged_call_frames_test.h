@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_PAGED_CALL_FRAMES_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_PAGED_CALL_FRAMES_TEST_H
+
+#include <chrono>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsPagedCallFramesTest : public TestEvents {
+public:
+    JsPagedCallFramesTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            auto start = std::chrono::steady_clock::now();
+            debugger_->NotifyPaused(location, PauseReason::INSTRUMENTATION);
+            auto pauseDuration = std::chrono::steady_clock::now() - start;
+            auto channel = static_cast<JsPagedCallFramesTestChannel *>(channel_);
+            ASSERT_EQ(channel->GetPausedCallFramesCount(), pageSize_);
+            ASSERT_TRUE(channel->GetPausedHasMore());
+
+            // fetch the rest of the stack page by page
+            start = std::chrono::steady_clock::now();
+            uint32_t recursionFrames = pageSize_;
+            std::string lastFunctionName;
+            bool hasMore = true;
+            for (uint32_t pageStart = pageSize_; hasMore; pageStart += pageSize_) {
+                std::vector<std::unique_ptr<CallFrame>> callFrames;
+                auto params = GetCallFramesParams::Create(*PtJson::Parse(
+                    "{\"start\":" + std::to_string(pageStart) + ",\"count\":" + std::to_string(pageSize_) + "}"));
+                ASSERT_NE(params, nullptr);
+                ASSERT_TRUE(debugger_->GetCallFrames(*params, &callFrames, &hasMore).IsOk());
+                ASSERT_LE(callFrames.size(), pageSize_);
+                for (uint32_t i = 0; i < callFrames.size(); i++) {
+                    ASSERT_EQ(callFrames[i]->GetCallFrameId(), static_cast<CallFrameId>(pageStart + i));
+                    lastFunctionName = callFrames[i]->GetFunctionName();
+                    if (lastFunctionName == "recursion") {
+                        recursionFrames++;
+                    }
+                }
+            }
+            auto pagingDuration = std::chrono::steady_clock::now() - start;
+            // 10001: recursion(10000) down to recursion(0)
+            ASSERT_EQ(recursionFrames, 10001U);
+            ASSERT_EQ(lastFunctionName, "func_main_0");
+
+            // the whole stack at once, as Debugger.paused without a limit
+            start = std::chrono::steady_clock::now();
+            std::vector<std::unique_ptr<CallFrame>> allCallFrames;
+            auto params = GetCallFramesParams::Create(*PtJson::Parse("{\"start\":0}"));
+            ASSERT_NE(params, nullptr);
+            ASSERT_TRUE(debugger_->GetCallFrames(*params, &allCallFrames, &hasMore).IsOk());
+            auto fullDuration = std::chrono::steady_clock::now() - start;
+            ASSERT_FALSE(hasMore);
+            ASSERT_EQ(allCallFrames.size(), recursionFrames + 1);  // 1: func_main_0
+            std::cout << "JsPagedCallFramesTest: pause in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(pauseDuration).count()
+                      << "us, page the rest in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(pagingDuration).count()
+                      << "us, full stack of " << allCallFrames.size() << " frames in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(fullDuration).count()
+                      << "us" << std::endl;
+
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            std::string pandaFile = DEBUGGER_ABC_DIR "paged_call_frames.abc";
+            std::string sourceFile = DEBUGGER_JS_DIR "paged_call_frames.js";
+            runtime_->Enable();
+            auto params = SetPausedCallFramesLimitParams::Create(
+                *PtJson::Parse("{\"limit\":" + std::to_string(pageSize_) + "}"));
+            ASSERT_NE(params, nullptr);
+            ASSERT_TRUE(debugger_->SetPausedCallFramesLimit(*params).IsOk());
+            // 17: breakpointer line, the deepest frame of the recursion
+            int32_t lineNumber = 17;
+            location_ = TestUtil::GetLocation(sourceFile.c_str(), lineNumber, 0, pandaFile.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            return true;
+        };
+
+        channel_ = new JsPagedCallFramesTestChannel();
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        std::string pandaFile = DEBUGGER_ABC_DIR "paged_call_frames.abc";
+        return {pandaFile, entryPoint_};
+    }
+    ~JsPagedCallFramesTest()
+    {
+        delete channel_;
+        channel_ = nullptr;
+    }
+
+private:
+    class JsPagedCallFramesTestChannel : public TestChannel {
+    public:
+        JsPagedCallFramesTestChannel() = default;
+        ~JsPagedCallFramesTestChannel() = default;
+
+        void SendNotification(const PtBaseEvents &events) override
+        {
+            if (events.GetName() != "Debugger.paused") {
+                return;
+            }
+            auto paused = static_cast<const Paused *>(&events);
+            pausedCallFramesCount_ = paused->GetCallFrames()->size();
+            pausedHasMore_ = paused->GetHasMore();
+        }
+
+        uint32_t GetPausedCallFramesCount() const
+        {
+            return pausedCallFramesCount_;
+        }
+
+        bool GetPausedHasMore() const
+        {
+            return pausedHasMore_;
+        }
+
+    private:
+        NO_COPY_SEMANTIC(JsPagedCallFramesTestChannel);
+        NO_MOVE_SEMANTIC(JsPagedCallFramesTestChannel);
+
+        uint32_t pausedCallFramesCount_ {0};
+        bool pausedHasMore_ {false};
+    };
+
+    // 50: call frames sent with Debugger.paused and fetched per Debugger.getCallFrames
+    uint32_t pageSize_ {50};
+    std::string entryPoint_ = "paged_call_frames";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    size_t breakpointCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsPagedCallFramesTest()
+{
+    return std::make_unique<JsPagedCallFramesTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_PAGED_CALL_FRAMES_TEST_H
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_STEP_HOT_LOOP_TEST_H
+#define ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_STEP_HOT_LOOP_TEST_H
+
+#include <chrono>
+
+#include "test/utils/test_util.h"
+
+namespace panda::ecmascript::tooling::test {
+class JsStepHotLoopTest : public TestEvents {
+public:
+    JsStepHotLoopTest()
+    {
+        breakpoint = [this](const JSPtLocation &location) {
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, location_);
+            ++breakpointCounter_;
+            TestUtil::SuspendUntilContinue(DebugEvent::BREAKPOINT, location);
+            debugger_->SetDebuggerState(DebuggerState::PAUSED);
+            debugger_->StepOver(StepOverParams());
+            stepStart_ = std::chrono::steady_clock::now();
+            return true;
+        };
+
+        // every bytecode of the hot loop is checked against the step over started at the bottom of the recursion
+        singleStep = [this](const JSPtLocation &location) {
+            ++singleStepCounter_;
+            if (!debugger_->NotifySingleStep(location)) {
+                return false;
+            }
+            auto stepDuration = std::chrono::steady_clock::now() - stepStart_;
+            ASSERT_TRUE(location.GetMethodId().IsValid());
+            ASSERT_LOCATION_EQ(location, stepLocation_);
+            ++stepCompleteCounter_;
+            std::cout << "JsStepHotLoopTest: step over " << singleStepCounter_ << " bytecodes in "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(stepDuration).count()
+                      << "us" << std::endl;
+            TestUtil::SuspendUntilContinue(DebugEvent::STEP_COMPLETE, location);
+            return true;
+        };
+
+        loadModule = [this](std::string_view moduleName) {
+            runtime_->Enable();
+            // 25: breakpointer line, the call of the hot loop at the bottom of the recursion
+            location_ = TestUtil::GetLocation(sourceFile_.c_str(), 25, 0, pandaFile_.c_str());
+            ASSERT_TRUE(location_.GetMethodId().IsValid());
+            // 26: the line after the hot loop returns
+            stepLocation_ = TestUtil::GetLocation(sourceFile_.c_str(), 26, 0, pandaFile_.c_str());
+            ASSERT_TRUE(stepLocation_.GetMethodId().IsValid());
+            TestUtil::SuspendUntilContinue(DebugEvent::LOAD_MODULE);
+            ASSERT_EQ(moduleName, pandaFile_);
+            ASSERT_TRUE(debugger_->NotifyScriptParsed(pandaFile_));
+            auto condFuncRef = FunctionRef::Undefined(vm_);
+            auto ret = debugInterface_->SetBreakpoint(location_, condFuncRef);
+            ASSERT_TRUE(ret);
+            return true;
+        };
+
+        scenario = [this]() {
+            TestUtil::WaitForLoadModule();
+            TestUtil::Continue();
+            TestUtil::WaitForBreakpoint(location_);
+            TestUtil::Continue();
+            TestUtil::WaitForStepComplete(stepLocation_);
+            TestUtil::Continue();
+            auto ret = debugInterface_->RemoveBreakpoint(location_);
+            ASSERT_TRUE(ret);
+            ASSERT_EXITED();
+            return true;
+        };
+
+        vmDeath = [this]() {
+            ASSERT_EQ(breakpointCounter_, 1U);  // 1: break point counter
+            ASSERT_EQ(stepCompleteCounter_, 1U);  // 1: step complete counter
+            return true;
+        };
+    }
+
+    std::pair<std::string, std::string> GetEntryPoint() override
+    {
+        return {pandaFile_, entryPoint_};
+    }
+    ~JsStepHotLoopTest() = default;
+
+private:
+    std::string pandaFile_ = DEBUGGER_ABC_DIR "step_hot_loop.abc";
+    std::string sourceFile_ = DEBUGGER_JS_DIR "step_hot_loop.js";
+    std::string entryPoint_ = "step_hot_loop";
+    JSPtLocation location_ {nullptr, JSPtLocation::EntityId(0), 0};
+    JSPtLocation stepLocation_ {nullptr, JSPtLocation::EntityId(0), 0};
+    std::chrono::steady_clock::time_point stepStart_ {};
+    size_t breakpointCounter_ = 0;
+    size_t singleStepCounter_ = 0;
+    size_t stepCompleteCounter_ = 0;
+};
+
+std::unique_ptr<TestEvents> GetJsStepHotLoopTest()
+{
+    return std::make_unique<JsStepHotLoopTest>();
+}
+}  // namespace panda::ecmascript::tooling::test
+
+#endif  // ECMASCRIPT_TOOLING_TEST_UTILS_TESTCASES_JS_STEP_HOT_LOOP_TEST_H
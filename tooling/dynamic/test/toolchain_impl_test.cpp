@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "agent/toolchain_impl.h"
+#include "ecmascript/tests/test_helper.h"
+#include "protocol_handler.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::tooling;
+
+namespace panda::test {
+class ToolchainImplTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(ecmaVm, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(ecmaVm, scope);
+    }
+
+protected:
+    EcmaVM *ecmaVm {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+HWTEST_F_L0(ToolchainImplTest, ProtocolMetricsRecordTest)
+{
+    ProtocolMetrics metrics;
+    ASSERT_FALSE(metrics.IsEnabled());
+    metrics.RecordCall("Debugger.enable", 10, 100);
+    metrics.RecordCall("Debugger.enable", 30, 50);
+    metrics.RecordCall("Runtime.enable", 5, 20);
+    metrics.RecordBytesOut("Debugger.enable", 64);
+    metrics.RecordEventOut("Debugger.scriptParsed", 128);
+    metrics.RecordEventOut("Debugger.scriptParsed", 128);
+
+    std::map<std::string, MethodMetrics> result = metrics.GetMetrics();
+    ASSERT_EQ(result.size(), 2U);
+    const MethodMetrics &enable = result["Debugger.enable"];
+    EXPECT_EQ(enable.callCount, 2U);
+    EXPECT_EQ(enable.totalTime, 40U);
+    EXPECT_EQ(enable.maxTime, 30U);
+    EXPECT_EQ(enable.bytesIn, 150U);
+    EXPECT_EQ(enable.bytesOut, 64U);
+    const MethodMetrics &runtime = result["Runtime.enable"];
+    EXPECT_EQ(runtime.callCount, 1U);
+    EXPECT_EQ(runtime.maxTime, 5U);
+    EXPECT_EQ(runtime.bytesOut, 0U);
+    // events are kept apart from the methods, counted by the number and the bytes sent out
+    std::map<std::string, MethodMetrics> events = metrics.GetEventMetrics();
+    ASSERT_EQ(events.size(), 1U);
+    const MethodMetrics &scriptParsed = events["Debugger.scriptParsed"];
+    EXPECT_EQ(scriptParsed.callCount, 2U);
+    EXPECT_EQ(scriptParsed.bytesOut, 256U);
+
+    metrics.Reset();
+    ASSERT_TRUE(metrics.GetMetrics().empty());
+    ASSERT_TRUE(metrics.GetEventMetrics().empty());
+}
+
+HWTEST_F_L0(ToolchainImplTest, EnableAndDisableTest)
+{
+    ProtocolMetrics metrics;
+    auto toolchain = std::make_unique<ToolchainImpl>(&metrics);
+    ASSERT_TRUE(toolchain->EnableProtocolMetrics().IsOk());
+    ASSERT_TRUE(metrics.IsEnabled());
+    metrics.RecordCall("Debugger.pause", 1, 1);
+    metrics.RecordEventOut("Debugger.paused", 1);
+    std::map<std::string, MethodMetrics> result;
+    std::map<std::string, MethodMetrics> events;
+    ASSERT_TRUE(toolchain->GetProtocolMetrics(&result, &events).IsOk());
+    ASSERT_EQ(result.size(), 1U);
+    ASSERT_EQ(events.size(), 1U);
+    ASSERT_TRUE(toolchain->ResetProtocolMetrics().IsOk());
+    ASSERT_TRUE(toolchain->GetProtocolMetrics(&result, &events).IsOk());
+    ASSERT_TRUE(result.empty());
+    ASSERT_TRUE(events.empty());
+    ASSERT_TRUE(toolchain->DisableProtocolMetrics().IsOk());
+    ASSERT_FALSE(metrics.IsEnabled());
+}
+
+HWTEST_F_L0(ToolchainImplTest, DispatcherImplDispatchTest)
+{
+    std::string result = "";
+    std::function<void(const void*, const std::string &)> callback =
+        [&result]([[maybe_unused]] const void *ptr, const std::string &temp) { result = temp; };
+    ProtocolChannel *channel = new ProtocolHandler(callback, ecmaVm);
+    ProtocolMetrics metrics;
+    auto toolchain = std::make_unique<ToolchainImpl>(&metrics);
+    auto dispatcherImpl = std::make_unique<ToolchainImpl::DispatcherImpl>(channel, std::move(toolchain));
+    std::string msg = std::string() + R"({"id":0,"method":"Toolchain.Test","params":{}})";
+    DispatchRequest request(msg);
+    dispatcherImpl->Dispatch(request);
+    ASSERT_TRUE(result.find("Unknown method: Test") != std::string::npos);
+
+    msg = std::string() + R"({"id":1,"method":"Toolchain.enableProtocolMetrics","params":{}})";
+    DispatchRequest request1(msg);
+    dispatcherImpl->Dispatch(request1);
+    ASSERT_EQ(result, R"({"id":1,"result":{}})");
+    ASSERT_TRUE(metrics.IsEnabled());
+
+    msg = std::string() + R"({"id":2,"method":"Toolchain.getProtocolMetrics","params":{}})";
+    DispatchRequest request2(msg);
+    dispatcherImpl->Dispatch(request2);
+    ASSERT_EQ(result, R"({"id":2,"result":{"metrics":[],"events":[]}})");
+    if (channel) {
+        delete channel;
+        channel = nullptr;
+    }
+}
+
+HWTEST_F_L0(ToolchainImplTest, ProtocolHandlerMetricsTest)
+{
+    std::vector<std::string> replies;
+    std::function<void(const void*, const std::string &)> callback =
+        [&replies]([[maybe_unused]] const void *ptr, const std::string &temp) { replies.emplace_back(temp); };
+    auto protocol = std::make_unique<ProtocolHandler>(callback, ecmaVm);
+    std::string unknownMsg = R"({"id":2,"method":"Tracing.Test","params":{}})";
+    protocol->DispatchCommand(R"({"id":1,"method":"Toolchain.enableProtocolMetrics","params":{}})");
+    protocol->DispatchCommand(std::string(unknownMsg));
+    protocol->DispatchCommand(R"({"id":3,"method":"Tracing.Test","params":{}})");
+    protocol->ProcessCommand();
+    ASSERT_EQ(replies.size(), 3U);
+
+    std::map<std::string, MethodMetrics> metrics = protocol->GetDispatcher()->GetProtocolMetrics()->GetMetrics();
+    // the request enabling the metrics is not timed, only its reply is counted
+    ASSERT_EQ(metrics["Toolchain.enableProtocolMetrics"].callCount, 0U);
+    EXPECT_EQ(metrics["Toolchain.enableProtocolMetrics"].bytesOut, replies[0].size());
+    const MethodMetrics &test = metrics["Tracing.Test"];
+    EXPECT_EQ(test.callCount, 2U);
+    EXPECT_EQ(test.bytesIn, unknownMsg.size() * 2);
+    EXPECT_EQ(test.bytesOut, replies[1].size() + replies[2].size());
+    EXPECT_GE(test.totalTime, test.maxTime);
+
+    protocol->DispatchCommand(R"({"id":4,"method":"Toolchain.disableProtocolMetrics","params":{}})");
+    protocol->DispatchCommand(R"({"id":5,"method":"Tracing.Test","params":{}})");
+    protocol->ProcessCommand();
+    metrics = protocol->GetDispatcher()->GetProtocolMetrics()->GetMetrics();
+    EXPECT_EQ(metrics["Tracing.Test"].callCount, 2U);
+}
+
+HWTEST_F_L0(ToolchainImplTest, ProtocolHandlerMetricsExcludeReplyTest)
+{
+    // a slow transport, the handler time of a request should not include sending its reply
+    constexpr auto writeCost = std::chrono::milliseconds(20);
+    std::vector<std::string> replies;
+    std::function<void(const void*, const std::string &)> callback =
+        [&replies, &writeCost]([[maybe_unused]] const void *ptr, const std::string &temp) {
+            std::this_thread::sleep_for(writeCost);
+            replies.emplace_back(temp);
+        };
+    auto protocol = std::make_unique<ProtocolHandler>(callback, ecmaVm);
+    protocol->DispatchCommand(R"({"id":1,"method":"Toolchain.enableProtocolMetrics","params":{}})");
+    protocol->DispatchCommand(R"({"id":2,"method":"Tracing.Test","params":{}})");
+    protocol->ProcessCommand();
+    Resumed resumed;
+    protocol->SendNotification(resumed);
+    ASSERT_EQ(replies.size(), 3U);
+
+    ProtocolMetrics *metrics = protocol->GetDispatcher()->GetProtocolMetrics();
+    std::map<std::string, MethodMetrics> methods = metrics->GetMetrics();
+    EXPECT_EQ(methods["Tracing.Test"].callCount, 1U);
+    EXPECT_LT(methods["Tracing.Test"].maxTime,
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(writeCost).count()));
+    // the event is not mixed with the methods
+    EXPECT_EQ(methods.count("Debugger.resumed"), 0U);
+    std::map<std::string, MethodMetrics> events = metrics->GetEventMetrics();
+    EXPECT_EQ(events["Debugger.resumed"].callCount, 1U);
+    EXPECT_EQ(events["Debugger.resumed"].bytesOut, replies[2].size());
+}
+}  // namespace panda::test
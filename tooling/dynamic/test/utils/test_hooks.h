@@ -120,8 +120,11 @@ public:
 
     void DisableFirstTimeFlag() override {}
 
-    void GenerateAsyncFrames([[maybe_unused]] std::shared_ptr<AsyncStack> asyncStack,
-        [[maybe_unused]] bool skipTopFrame) override {}
+    void GenerateAsyncFrames(std::shared_ptr<AsyncStack> asyncStack, bool skipTopFrame) override
+    {
+        [[maybe_unused]] LocalScope scope(vm_);
+        debugger_->GenerateAsyncFrames(asyncStack, skipTopFrame);
+    }
 
     void HitSymbolicBreakpoint() override {}
 
@@ -28,6 +28,16 @@
 #include "test/testcases/js_variable_first_test.h"
 #include "test/testcases/js_variable_second_test.h"
 #include "test/testcases/js_dropframe_test.h"
+#include "test/testcases/js_large_method_test.h"
+#include "test/testcases/js_lazy_scope_test.h"
+#include "test/testcases/js_object_group_test.h"
+#include "test/testcases/js_condition_cache_test.h"
+#include "test/testcases/js_logpoint_test.h"
+#include "test/testcases/js_async_chain_test.h"
+#include "test/testcases/js_large_object_test.h"
+#include "test/testcases/js_blackbox_test.h"
+#include "test/testcases/js_paged_call_frames_test.h"
+#include "test/testcases/js_step_hot_loop_test.h"
 
 namespace panda::ecmascript::tooling::test {
 static std::string g_currentTestName = "";
@@ -45,6 +55,16 @@ static void RegisterTests()
     TestUtil::RegisterTest("JSDropFrameTest", GetJsDropFrameTest());
     TestUtil::RegisterTest("JsVariableFirstTest", GetJsVariableFirstTest());
     TestUtil::RegisterTest("JsVariableSecondTest", GetJsVariableSecondTest());
+    TestUtil::RegisterTest("JsLazyScopeTest", GetJsLazyScopeTest());
+    TestUtil::RegisterTest("JsPagedCallFramesTest", GetJsPagedCallFramesTest());
+    TestUtil::RegisterTest("JsLargeMethodTest", GetJsLargeMethodTest());
+    TestUtil::RegisterTest("JsStepHotLoopTest", GetJsStepHotLoopTest());
+    TestUtil::RegisterTest("JsObjectGroupTest", GetJsObjectGroupTest());
+    TestUtil::RegisterTest("JsConditionCacheTest", GetJsConditionCacheTest());
+    TestUtil::RegisterTest("JsLogpointTest", GetJsLogpointTest());
+    TestUtil::RegisterTest("JsAsyncChainTest", GetJsAsyncChainTest());
+    TestUtil::RegisterTest("JsLargeObjectTest", GetJsLargeObjectTest());
+    TestUtil::RegisterTest("JsBlackboxTest", GetJsBlackboxTest());
 }
 
 std::vector<const char *> GetTestList()
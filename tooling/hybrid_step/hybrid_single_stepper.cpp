@@ -21,27 +21,15 @@ HybridSingleStepper& HybridSingleStepper::GetInstance()
     return instance;
 }
 
-bool HybridSingleStepper::GetFlagWithLock(std::shared_mutex &mutex, const bool &flag) const
-{
-    std::shared_lock<std::shared_mutex> readLock(mutex);
-    return flag;
-}
-
-void HybridSingleStepper::SetFlagWithLock(std::shared_mutex &mutex, bool &flag, bool value) const
-{
-    std::unique_lock<std::shared_mutex> writeLock(mutex);
-    flag = value;
-}
-
 bool HybridSingleStepper::GetHybridSingleStepFlag(HybridStepDirection direction) const
 {
     bool result = false;
     switch (direction) {
         case HybridStepDirection::DYNAMIC_TO_STATIC:
-            result = GetFlagWithLock(dynToStatMutex_, dynamicToStatic_);
+            result = dynamicToStatic_.load(std::memory_order_relaxed);
             break;
         case HybridStepDirection::STATIC_TO_DYNAMIC:
-            result = GetFlagWithLock(statToDynMutex_, staticToDynamic_);
+            result = staticToDynamic_.load(std::memory_order_relaxed);
             break;
         default:
             break;
@@ -53,10 +41,10 @@ void HybridSingleStepper::SetHybridSingleStepFlag(HybridStepDirection direction,
 {
     switch (direction) {
         case HybridStepDirection::DYNAMIC_TO_STATIC:
-            SetFlagWithLock(dynToStatMutex_, dynamicToStatic_, value);
+            dynamicToStatic_.store(value, std::memory_order_relaxed);
             break;
         case HybridStepDirection::STATIC_TO_DYNAMIC:
-            SetFlagWithLock(statToDynMutex_, staticToDynamic_, value);
+            staticToDynamic_.store(value, std::memory_order_relaxed);
             break;
         default:
             break;
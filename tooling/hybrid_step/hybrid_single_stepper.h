@@ -16,8 +16,7 @@
 #ifndef HYBRID_SINGLE_STEPPER_H
 #define HYBRID_SINGLE_STEPPER_H
 
-#include <mutex>
-#include <shared_mutex>
+#include <atomic>
 
 enum class HybridStepDirection {
     DYNAMIC_TO_STATIC,
@@ -36,16 +35,11 @@ public:
     void SetHybridSingleStepFlag(HybridStepDirection direction, bool value);
 
 private:
-    bool GetFlagWithLock(std::shared_mutex &mutex, const bool &flag) const;
-
-    void SetFlagWithLock(std::shared_mutex &mutex, bool &flag, bool value) const;
-
-    // Mutex for dynamic to static stepper flag
-    mutable std::shared_mutex dynToStatMutex_;
-    // Mutex for static to dynamic stepper flag
-    mutable std::shared_mutex statToDynMutex_;
-
-    bool dynamicToStatic_ { false };
-    bool staticToDynamic_ { false };
+    // The flags are polled on every bytecode while debugging, they do not guard any other data,
+    // so relaxed loads and stores are enough
+    // Dynamic to static stepper flag
+    std::atomic<bool> dynamicToStatic_ { false };
+    // Static to dynamic stepper flag
+    std::atomic<bool> staticToDynamic_ { false };
 };
 #endif // HYBRID_SINGLE_STEPPER_H
\ No newline at end of file